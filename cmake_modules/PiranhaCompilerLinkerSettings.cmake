@@ -51,6 +51,14 @@ macro(PIRANHA_CHECK_UINT128_T)
 	ELSE()
 		MESSAGE(STATUS "No 128-bit unsigned integer type detected.")
 	ENDIF()
+	# The signed counterpart is used as an exponent type in Kronecker monomials.
+	CHECK_TYPE_SIZE("__int128_t" PIRANHA_INT128_T)
+	IF(PIRANHA_UINT128_T AND PIRANHA_INT128_T)
+		MESSAGE(STATUS "128-bit signed integer type detected.")
+		SET(PIRANHA_HAVE_INT128_T "#define PIRANHA_INT128_T __int128_t")
+	ELSE()
+		MESSAGE(STATUS "No 128-bit signed integer type detected.")
+	ENDIF()
 endmacro(PIRANHA_CHECK_UINT128_T)
 
 # Configuration for GCC.
@@ -40,6 +40,7 @@
 #include "../src/kronecker_monomial.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
+#include "../src/double_double.hpp"
 #include "../src/real.hpp"
 #include "../src/exceptions.hpp"
 #include "../src/math.hpp"
@@ -142,11 +143,13 @@ BOOST_PYTHON_MODULE(_core)
 	pyranha::expose_type_generator<piranha::integer>("integer");
 	pyranha::expose_type_generator<piranha::rational>("rational");
 	pyranha::expose_type_generator<piranha::real>("real");
+	pyranha::expose_type_generator<piranha::double_double>("double_double");
 	pyranha::expose_generic_type_generator<piranha::kronecker_monomial>();
 	// Arithmetic converters.
 	pyranha::integer_converter i_c;
 	pyranha::rational_converter ra_c;
 	pyranha::real_converter re_c;
+	pyranha::double_double_converter dd_c;
 	// Exceptions translation.
 	pyranha::generic_translate<&PyExc_ZeroDivisionError,piranha::zero_division_error>();
 	pyranha::generic_translate<&PyExc_NotImplementedError,piranha::not_implemented_error>();
@@ -22,6 +22,7 @@
 
 #include <tuple>
 
+#include "../src/double_double.hpp"
 #include "../src/kronecker_monomial.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
@@ -46,7 +47,8 @@ void expose_poisson_series()
 			std::tuple<piranha::polynomial<piranha::rational,signed char>>,std::tuple<piranha::polynomial<piranha::rational,short>>,
 			std::tuple<piranha::polynomial<piranha::rational,piranha::kronecker_monomial<>>>,
 			std::tuple<piranha::polynomial<piranha::real,signed char>>,std::tuple<piranha::polynomial<piranha::real,short>>,
-			std::tuple<piranha::polynomial<piranha::real,piranha::kronecker_monomial<>>>>;
+			std::tuple<piranha::polynomial<piranha::real,piranha::kronecker_monomial<>>>,
+			std::tuple<piranha::double_double>,std::tuple<piranha::polynomial<piranha::double_double,piranha::kronecker_monomial<>>>>;
 		using interop_types = std::tuple<double,piranha::rational,piranha::integer,piranha::real>;
 		using pow_types = std::tuple<double,piranha::integer,piranha::real>;
 		using eval_types = std::tuple<double,piranha::real,piranha::rational>;
@@ -22,6 +22,7 @@
 
 #include <tuple>
 
+#include "../src/double_double.hpp"
 #include "../src/kronecker_monomial.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
@@ -44,7 +45,8 @@ void expose_polynomials()
 		using params = std::tuple<std::tuple<double,signed char>,std::tuple<double,short>,std::tuple<double,piranha::kronecker_monomial<>>,
 			std::tuple<piranha::integer,signed char>,std::tuple<piranha::integer,short>,std::tuple<piranha::integer,piranha::kronecker_monomial<>>,
 			std::tuple<piranha::rational,signed char>,std::tuple<piranha::rational,short>,std::tuple<piranha::rational,piranha::kronecker_monomial<>>,
-			std::tuple<piranha::real,signed char>,std::tuple<piranha::real,short>,std::tuple<piranha::real,piranha::kronecker_monomial<>>>;
+			std::tuple<piranha::real,signed char>,std::tuple<piranha::real,short>,std::tuple<piranha::real,piranha::kronecker_monomial<>>,
+			std::tuple<piranha::double_double,piranha::kronecker_monomial<>>>;
 		using interop_types = std::tuple<double,piranha::integer,piranha::real,piranha::rational>;
 		using pow_types = std::tuple<double,piranha::integer,piranha::real>;
 		using eval_types = interop_types;
@@ -52,6 +52,7 @@
 #include <vector>
 
 #include "../src/detail/type_in_tuple.hpp"
+#include "../src/double_double.hpp"
 #include "../src/exceptions.hpp"
 #include "../src/math.hpp"
 #include "../src/mp_integer.hpp"
@@ -91,6 +92,7 @@ namespace std
 PYRANHA_EXPLICIT_CONVERSION_LIBCPP_WORKAROUND(piranha::rational)
 PYRANHA_EXPLICIT_CONVERSION_LIBCPP_WORKAROUND(piranha::real)
 PYRANHA_EXPLICIT_CONVERSION_LIBCPP_WORKAROUND(piranha::integer)
+PYRANHA_EXPLICIT_CONVERSION_LIBCPP_WORKAROUND(piranha::double_double)
 
 }
 
@@ -40,6 +40,7 @@
 #include "../src/exceptions.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
+#include "../src/double_double.hpp"
 #include "../src/real.hpp"
 
 // NOTE: useful resources for python converters and C API:
@@ -256,6 +257,24 @@ struct real_converter
 	}
 };
 
+// NOTE: double_double is converted to Python via real (i.e., as an mpmath mpf object). There is no
+// converter from Python, as mpf objects are already picked up by the real converter: series with double_double
+// coefficients are constructed and combined with Python objects via the usual interoperable types.
+struct double_double_converter
+{
+	double_double_converter()
+	{
+		bp::to_python_converter<piranha::double_double,to_python>();
+	}
+	struct to_python
+	{
+		static PyObject *convert(const piranha::double_double &d)
+		{
+			return real_converter::to_python::convert(static_cast<piranha::real>(d));
+		}
+	};
+};
+
 }
 
 #endif
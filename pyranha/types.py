@@ -56,6 +56,10 @@ rational = _t.rational
 #: This generator represents the multiprecision floating-point type provided by the piranha C++ library.
 real = _t.real
 
+#: This generator represents the double-double floating-point type provided by the piranha C++ library
+#: (about 106 bits of precision, with hardware-speed arithmetic).
+double_double = _t.double_double
+
 #:
 kronecker_monomial = _t.kronecker_monomial
 
@@ -0,0 +1,56 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_CONFIG_HPP
+#define PIRANHA_CONFIG_HPP
+
+// Start of defines instantiated by CMake.
+#define PIRANHA_HAVE_PTHREAD_AFFINITY
+#define PIRANHA_HAVE_POSIX_MEMALIGN
+#define PIRANHA_VERSION "2026.10.18"
+
+#define PIRANHA_UINT128_T __uint128_t
+#define PIRANHA_INT128_T __int128_t
+// End of defines instantiated by CMake.
+
+#include <cassert>
+
+#define piranha_assert assert
+
+// NOTE: clang has to go first, as it might define __GNUC__ internally.
+// Same thing could happen with ICC.
+#if defined(__clang__)
+	#include "detail/config_clang.hpp"
+#elif defined(__INTEL_COMPILER)
+	#include "detail/config_intel.hpp"
+#elif defined(__GNUC__)
+	#include "detail/config_gcc.hpp"
+#else
+	// NOTE: addidtional compiler configurations go here or in separate file as above.
+	#define likely(x) (x)
+	#define unlikely(x) (x)
+#endif
+
+// Ugh.
+// http://web.archiveorange.com/archive/v/NDiIbUvkEafCV0VHMIwL
+#include <boost/integer_traits.hpp>
+static_assert(boost::integer_traits<long long>::const_max >= 0,"Buggy integer_traits implementation: please update the Boost libraries.");
+
+#endif
@@ -80,6 +80,23 @@ inline Retval monomial_partial_degree(const Container &c, const Op &op, const st
 	return retval;
 }
 
+// Partial degree, with the positions of the active symbols precomputed.
+template <typename Retval, typename Container, typename Op>
+inline Retval monomial_partial_degree(const Container &c, const Op &op, const symbol_set::positions &p, const symbol_set &args)
+{
+	if (unlikely(args.size() != c.size())) {
+		piranha_throw(std::invalid_argument,"invalid arguments set");
+	}
+	if (unlikely(p.size() && p.back() >= args.size())) {
+		piranha_throw(std::invalid_argument,"invalid positions");
+	}
+	Retval retval(0);
+	for (const auto &i: p) {
+		op(retval,c[static_cast<decltype(c.size())>(i)]);
+	}
+	return retval;
+}
+
 // Less-than comparator (we do not use std::less because that can be specialised, and here
 // we want to force the use of the builtin operator in conjunction with the is_less_than_comparable
 // type trait).
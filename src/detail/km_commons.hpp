@@ -29,7 +29,9 @@
 
 #include "../config.hpp"
 #include "../exceptions.hpp"
+#include "kronecker_int.hpp"
 #include "../math.hpp"
+#include "symbol_set_remap.hpp"
 #include "../symbol_set.hpp"
 #include "../type_traits.hpp"
 
@@ -52,31 +54,14 @@ inline VType km_unpack(const symbol_set &args, const T &value)
 template <typename VType, typename KaType, typename T>
 inline T km_merge_args(const symbol_set &orig_args, const symbol_set &new_args, const T &value)
 {
-	using size_type = min_int<typename VType::size_type,decltype(new_args.size())>;
-	if (unlikely(new_args.size() <= orig_args.size() ||
-		!std::includes(new_args.begin(),new_args.end(),orig_args.begin(),orig_args.end())))
-	{
-		piranha_throw(std::invalid_argument,"invalid argument(s) for symbol set merging");
-	}
-	piranha_assert(std::is_sorted(orig_args.begin(),orig_args.end()));
-	piranha_assert(std::is_sorted(new_args.begin(),new_args.end()));
+	using size_type = typename VType::size_type;
+	const auto &map = ss_merge_remap(orig_args,new_args);
 	const auto old_vector = km_unpack<VType,KaType>(orig_args,value);
 	VType new_vector;
-	auto it_new = new_args.begin();
-	for (size_type i = 0u; i < old_vector.size(); ++i, ++it_new) {
-		while (*it_new != orig_args[i]) {
-			// NOTE: for arbitrary int types, value_type(0) might throw. Update docs
-			// if needed.
-			new_vector.push_back(T(0));
-			piranha_assert(it_new != new_args.end());
-			++it_new;
-			piranha_assert(it_new != new_args.end());
-		}
-		new_vector.push_back(old_vector[i]);
-	}
-	// Fill up arguments at the tail of new_args but not in orig_args.
-	for (; it_new != new_args.end(); ++it_new) {
-		new_vector.push_back(T(0));
+	for (const auto &idx: map) {
+		// NOTE: for arbitrary int types, value_type(0) might throw. Update docs
+		// if needed.
+		new_vector.push_back((idx == orig_args.size()) ? T(0) : old_vector[static_cast<size_type>(idx)]);
 	}
 	piranha_assert(new_vector.size() == new_args.size());
 	// Return new encoded value.
@@ -87,24 +72,40 @@ template <typename T>
 inline void km_safe_adder(T &a, const T &b)
 {
 	if (b >= T(0)) {
-		if (unlikely(a > boost::integer_traits<T>::const_max - b)) {
+		if (unlikely(a > ka_int_traits<T>::max() - b)) {
 			piranha_throw(std::overflow_error,"overflow in the addition of two exponents in a Kronecker monomial");
 		}
 	} else {
-		if (unlikely(a < boost::integer_traits<T>::const_min - b)) {
+		if (unlikely(a < ka_int_traits<T>::min() - b)) {
 			piranha_throw(std::overflow_error,"overflow in the addition of two exponents in a Kronecker monomial");
 		}
 	}
 	a = static_cast<T>(a + b);
 }
 
+// Adder for the exponents of a single Kronecker code.
+// NOTE: the sum of the absolute values of the components of a vector encoded in a Kronecker array is bounded by
+// h_max - h_min, which is representable by construction. Hence, when accumulating the (absolute values of the) components
+// decoded from a single code, no overflow check is needed.
+template <typename T>
+inline void km_bounded_adder(T &a, const T &b)
+{
+	a = static_cast<T>(a + b);
+}
+
+template <typename T>
+inline void km_bounded_abs_adder(T &a, const T &b)
+{
+	a = static_cast<T>(a + ((b >= T(0)) ? b : static_cast<T>(-b)));
+}
+
 template <typename T>
 inline void km_safe_abs_adder(T &a, const T &b)
 {
 	// NOTE: here it is safe to take abs() because b is coming from a Kronecker array, where the numeric bounds are
 	// symmetric by construction.
-	const T abs_b = math::abs(b);
-	if (unlikely(a > boost::integer_traits<T>::const_max - abs_b)) {
+	const T abs_b = (b >= T(0)) ? b : static_cast<T>(-b);
+	if (unlikely(a > ka_int_traits<T>::max() - abs_b)) {
 		piranha_throw(std::overflow_error,"overflow in the addition of two exponents in a Kronecker monomial");
 	}
 	a = static_cast<T>(a + abs_b);
@@ -124,13 +125,12 @@ inline void km_trim_identify(symbol_set &candidates, const symbol_set &args, con
 template <typename VType, typename KaType, typename T>
 inline T km_trim(const symbol_set &trim_args, const symbol_set &orig_args, const T &value)
 {
-	using size_type = min_int<typename VType::size_type,decltype(orig_args.size())>;
+	using size_type = typename VType::size_type;
+	const auto &map = ss_trim_remap(trim_args,orig_args);
 	const VType tmp = km_unpack<VType,KaType>(orig_args,value);
 	VType new_vector;
-	for (size_type i = 0u; i < tmp.size(); ++i) {
-		if (!std::binary_search(trim_args.begin(),trim_args.end(),orig_args[i])) {
-			new_vector.push_back(tmp[i]);
-		}
+	for (const auto &idx: map) {
+		new_vector.push_back(tmp[static_cast<size_type>(idx)]);
 	}
 	return KaType::encode(new_vector);
 }
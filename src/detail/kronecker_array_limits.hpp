@@ -0,0 +1,270 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_DETAIL_KRONECKER_ARRAY_LIMITS_HPP
+#define PIRANHA_DETAIL_KRONECKER_ARRAY_LIMITS_HPP
+
+#include <cstddef>
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Precomputed limits for piranha::kronecker_array, indexed by the number of bits of the signed integer type
+// (including the sign bit). The values are those produced by kronecker_array::determine_limit(), which
+// in debug builds is run at startup to check the consistency of the tables.
+// For each dimension m (starting from 1), the data consists of the m absolute values of the bounds on the
+// components (flattened in minmax()) and of the triplet h_min, h_max, h_max - h_min (in h()).
+template <std::size_t>
+struct kronecker_array_limits
+{
+	// Number of dimensions, including the empty dimension 0. A value of 0 signals that the table is not available.
+	static const std::size_t size = 0u;
+	static const long long *minmax()
+	{
+		return nullptr;
+	}
+	static const long long *h()
+	{
+		return nullptr;
+	}
+};
+
+template <>
+struct kronecker_array_limits<8u>
+{
+	static const std::size_t size = 5u;
+	static const long long *minmax()
+	{
+		static const long long data[] = {
+			37ll,
+			3ll,3ll,
+			1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll
+		};
+		return data;
+	}
+	static const long long *h()
+	{
+		static const long long data[] = {
+			-37ll,37ll,74ll,
+			-24ll,24ll,48ll,
+			-13ll,13ll,26ll,
+			-40ll,40ll,80ll
+		};
+		return data;
+	}
+};
+
+template <>
+struct kronecker_array_limits<16u>
+{
+	static const std::size_t size = 10u;
+	static const long long *minmax()
+	{
+		static const long long data[] = {
+			9293ll,
+			81ll,79ll,
+			8ll,8ll,7ll,
+			3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll
+		};
+		return data;
+	}
+	static const long long *h()
+	{
+		static const long long data[] = {
+			-9293ll,9293ll,18586ll,
+			-12958ll,12958ll,25916ll,
+			-2167ll,2167ll,4334ll,
+			-1200ll,1200ll,2400ll,
+			-8403ll,8403ll,16806ll,
+			-364ll,364ll,728ll,
+			-1093ll,1093ll,2186ll,
+			-3280ll,3280ll,6560ll,
+			-9841ll,9841ll,19682ll
+		};
+		return data;
+	}
+};
+
+template <>
+struct kronecker_array_limits<32u>
+{
+	static const std::size_t size = 20u;
+	static const long long *minmax()
+	{
+		static const long long data[] = {
+			606687317ll,
+			19460ll,22063ll,
+			590ll,638ll,587ll,
+			78ll,78ll,74ll,79ll,
+			18ll,18ll,18ll,18ll,17ll,
+			8ll,8ll,8ll,8ll,8ll,7ll,
+			8ll,8ll,8ll,8ll,8ll,8ll,7ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll
+		};
+		return data;
+	}
+	static const long long *h()
+	{
+		static const long long data[] = {
+			-606687317ll,606687317ll,1213374634ll,
+			-858733483ll,858733483ll,1717466966ll,
+			-886030487ll,886030487ll,1772060974ll,
+			-291979729ll,291979729ll,583959458ll,
+			-32797817ll,32797817ll,65595634ll,
+			-10648927ll,10648927ll,21297854ll,
+			-181031767ll,181031767ll,362063534ll,
+			-2882400ll,2882400ll,5764800ll,
+			-20176803ll,20176803ll,40353606ll,
+			-141237624ll,141237624ll,282475248ll,
+			-988663371ll,988663371ll,1977326742ll,
+			-265720ll,265720ll,531440ll,
+			-797161ll,797161ll,1594322ll,
+			-2391484ll,2391484ll,4782968ll,
+			-7174453ll,7174453ll,14348906ll,
+			-21523360ll,21523360ll,43046720ll,
+			-64570081ll,64570081ll,129140162ll,
+			-193710244ll,193710244ll,387420488ll,
+			-581130733ll,581130733ll,1162261466ll
+		};
+		return data;
+	}
+};
+
+template <>
+struct kronecker_array_limits<64u>
+{
+	static const std::size_t size = 40u;
+	static const long long *minmax()
+	{
+		static const long long data[] = {
+			3000052519351678883ll,
+			1035674591ll,1314379097ll,
+			637718ll,658770ll,567487ll,
+			19319ll,19851ll,21635ll,19661ll,
+			2493ll,2504ll,2753ll,2430ll,2609ll,
+			743ll,659ll,749ll,629ll,650ll,683ll,
+			165ll,173ll,165ll,155ll,165ll,153ll,157ll,
+			78ll,81ll,83ll,83ll,78ll,74ll,78ll,73ll,
+			39ll,39ll,39ll,39ll,36ll,39ll,36ll,39ll,37ll,
+			39ll,36ll,39ll,39ll,39ll,39ll,39ll,39ll,39ll,37ll,
+			18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,17ll,
+			18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,18ll,17ll,
+			8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,7ll,
+			8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,7ll,
+			8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,8ll,7ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,3ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,
+			1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll,1ll
+		};
+		return data;
+	}
+	static const long long *h()
+	{
+		static const long long data[] = {
+			-3000052519351678883ll,3000052519351678883ll,6000105038703357766ll,
+			-2722538069758902342ll,2722538069758902342ll,5445076139517804684ll,
+			-953629001179892287ll,953629001179892287ll,1907258002359784574ll,
+			-1305157073341076330ll,1305157073341076330ll,2610314146682152660ll,
+			-1744971743003927339ll,1744971743003927339ll,3489943486007854678ll,
+			-3291538524541513545ll,3291538524541513545ll,6583077049083027090ll,
+			-189231215387229067ll,189231215387229067ll,378462430774458134ll,
+			-192660690034080376ll,192660690034080376ll,385321380068160752ll,
+			-48577989392677837ll,48577989392677837ll,97155978785355674ll,
+			-4153085367119210737ll,4153085367119210737ll,8306170734238421474ll,
+			-84150226517312357ll,84150226517312357ll,168300453034624714ll,
+			-3113558381140557227ll,3113558381140557227ll,6227116762281114454ll,
+			-4369666779223207ll,4369666779223207ll,8739333558446414ll,
+			-74284335246794527ll,74284335246794527ll,148568670493589054ll,
+			-1262833699195506967ll,1262833699195506967ll,2525667398391013934ll,
+			-16616465284800ll,16616465284800ll,33232930569600ll,
+			-116315256993603ll,116315256993603ll,232630513987206ll,
+			-814206798955224ll,814206798955224ll,1628413597910448ll,
+			-5699447592686571ll,5699447592686571ll,11398895185373142ll,
+			-39896133148806000ll,39896133148806000ll,79792266297612000ll,
+			-279272932041642003ll,279272932041642003ll,558545864083284006ll,
+			-1954910524291494024ll,1954910524291494024ll,3909821048582988048ll,
+			-47071589413ll,47071589413ll,94143178826ll,
+			-141214768240ll,141214768240ll,282429536480ll,
+			-423644304721ll,423644304721ll,847288609442ll,
+			-1270932914164ll,1270932914164ll,2541865828328ll,
+			-3812798742493ll,3812798742493ll,7625597484986ll,
+			-11438396227480ll,11438396227480ll,22876792454960ll,
+			-34315188682441ll,34315188682441ll,68630377364882ll,
+			-102945566047324ll,102945566047324ll,205891132094648ll,
+			-308836698141973ll,308836698141973ll,617673396283946ll,
+			-926510094425920ll,926510094425920ll,1853020188851840ll,
+			-2779530283277761ll,2779530283277761ll,5559060566555522ll,
+			-8338590849833284ll,8338590849833284ll,16677181699666568ll,
+			-25015772549499853ll,25015772549499853ll,50031545098999706ll,
+			-75047317648499560ll,75047317648499560ll,150094635296999120ll,
+			-225141952945498681ll,225141952945498681ll,450283905890997362ll,
+			-675425858836496044ll,675425858836496044ll,1350851717672992088ll,
+			-2026277576509488133ll,2026277576509488133ll,4052555153018976266ll
+		};
+		return data;
+	}
+};
+
+}
+
+}
+
+#endif
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_DETAIL_KRONECKER_INT_HPP
+#define PIRANHA_DETAIL_KRONECKER_INT_HPP
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "../mp_integer.hpp"
+
+// Support for the signed integer types usable in Kronecker codes. These are the standard signed integral types
+// and, if available, the 128-bit signed integer type. The latter is not recognised by the standard type traits
+// in strict ISO mode (and it is not supported by the streaming operators and by piranha::integer),
+// so all the integral properties and conversions needed by the Kronecker classes are routed through here.
+
+namespace piranha { namespace detail {
+
+template <typename T, typename = void>
+struct ka_int_traits
+{
+	static const bool value = false;
+};
+
+template <typename T>
+struct ka_int_traits<T,typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value &&
+	std::numeric_limits<T>::is_bounded>::type>
+{
+	static const bool value = true;
+	using uint_type = typename std::make_unsigned<T>::type;
+	// Number of value bits.
+	static const unsigned digits = static_cast<unsigned>(std::numeric_limits<T>::digits);
+	static constexpr T max()
+	{
+		return std::numeric_limits<T>::max();
+	}
+	static constexpr T min()
+	{
+		return std::numeric_limits<T>::min();
+	}
+};
+
+#if defined(PIRANHA_INT128_T)
+
+template <>
+struct ka_int_traits<PIRANHA_INT128_T>
+{
+	static const bool value = true;
+	using uint_type = PIRANHA_UINT128_T;
+	static const unsigned digits = 127u;
+	static constexpr PIRANHA_INT128_T max()
+	{
+		return static_cast<PIRANHA_INT128_T>(~uint_type(0) >> 1u);
+	}
+	static constexpr PIRANHA_INT128_T min()
+	{
+		return static_cast<PIRANHA_INT128_T>(-max() - 1);
+	}
+};
+
+#endif
+
+// Test if T is the 128-bit signed integer.
+template <typename T>
+struct ka_is_int128
+{
+#if defined(PIRANHA_INT128_T)
+	static const bool value = std::is_same<T,PIRANHA_INT128_T>::value;
+#else
+	static const bool value = false;
+#endif
+};
+
+// Conversion to piranha::integer.
+template <typename T, typename std::enable_if<!ka_is_int128<T>::value,int>::type = 0>
+inline integer ka_to_integer(const T &n)
+{
+	return integer(n);
+}
+
+// Conversion from piranha::integer, throwing std::overflow_error if n is not representable by T.
+template <typename T, typename std::enable_if<!ka_is_int128<T>::value,int>::type = 0>
+inline T ka_from_integer(const integer &n)
+{
+	return static_cast<T>(n);
+}
+
+#if defined(PIRANHA_INT128_T)
+
+template <typename T, typename std::enable_if<ka_is_int128<T>::value,int>::type = 0>
+inline integer ka_to_integer(const T &n)
+{
+	using u_type = PIRANHA_UINT128_T;
+	// NOTE: the absolute value is computed in the unsigned domain, where the negation of the minimum value is well-defined.
+	const u_type abs_n = (n < 0) ? static_cast<u_type>(-static_cast<u_type>(n)) : static_cast<u_type>(n);
+	integer retval(static_cast<unsigned long long>(abs_n >> 64u));
+	retval *= integer(2).pow(64u);
+	retval += static_cast<unsigned long long>(abs_n);
+	if (n < 0) {
+		retval.negate();
+	}
+	return retval;
+}
+
+template <typename T, typename std::enable_if<ka_is_int128<T>::value,int>::type = 0>
+inline T ka_from_integer(const integer &n)
+{
+	using u_type = PIRANHA_UINT128_T;
+	if (unlikely(n > ka_to_integer(ka_int_traits<T>::max()) || n < ka_to_integer(ka_int_traits<T>::min()))) {
+		piranha_throw(std::overflow_error,"invalid conversion to a 128-bit integer");
+	}
+	const integer abs_n = n.abs(), base = integer(2).pow(64u);
+	const u_type retval = (static_cast<u_type>(static_cast<unsigned long long>(abs_n / base)) << 64u) +
+		static_cast<unsigned long long>(abs_n % base);
+	return (n.sign() < 0) ? static_cast<T>(-retval) : static_cast<T>(retval);
+}
+
+#endif
+
+// Checked conversion between numerical types, equivalent to boost::numeric_cast but supporting the 128-bit
+// integer type.
+template <typename To, typename From, typename std::enable_if<!ka_is_int128<To>::value && !ka_is_int128<From>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	return boost::numeric_cast<To>(x);
+}
+
+template <typename To, typename From, typename std::enable_if<ka_is_int128<To>::value && !ka_is_int128<From>::value && std::is_integral<From>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	// NOTE: all the standard integral types fit in 128 bits.
+	return static_cast<To>(x);
+}
+
+template <typename To, typename From, typename std::enable_if<ka_is_int128<To>::value && std::is_floating_point<From>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	try {
+		return ka_from_integer<To>(integer(x));
+	} catch (const std::overflow_error &) {
+		throw boost::numeric::bad_numeric_cast();
+	}
+}
+
+template <typename To, typename From, typename std::enable_if<ka_is_int128<To>::value && std::is_same<To,From>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	return x;
+}
+
+template <typename To, typename From, typename std::enable_if<ka_is_int128<From>::value && !ka_is_int128<To>::value && std::is_integral<To>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	if (x > static_cast<From>(std::numeric_limits<To>::max())) {
+		throw boost::numeric::positive_overflow();
+	}
+	if (x < static_cast<From>(std::numeric_limits<To>::min())) {
+		throw boost::numeric::negative_overflow();
+	}
+	return static_cast<To>(x);
+}
+
+template <typename To, typename From, typename std::enable_if<ka_is_int128<From>::value && std::is_floating_point<To>::value,int>::type = 0>
+inline To ka_numeric_cast(const From &x)
+{
+	return static_cast<To>(x);
+}
+
+// Hasher for Kronecker codes. std::hash is not guaranteed to be available for the 128-bit integer.
+struct ka_hasher
+{
+	template <typename T>
+	std::size_t operator()(const T &n) const noexcept
+	{
+		return static_cast<std::size_t>(n);
+	}
+};
+
+// Exponent in a form suitable for use with the generic piranha functions (e.g., math::pow(), streaming): the
+// 128-bit integer is converted to piranha::integer, the other types are passed through.
+template <typename T, typename std::enable_if<!ka_is_int128<T>::value,int>::type = 0>
+inline const T &ka_expo(const T &n)
+{
+	return n;
+}
+
+template <typename T, typename std::enable_if<ka_is_int128<T>::value,int>::type = 0>
+inline integer ka_expo(const T &n)
+{
+	return ka_to_integer(n);
+}
+
+}}
+
+#endif
@@ -0,0 +1,132 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+#ifndef PIRANHA_DETAIL_POW_CACHE_HPP
+#define PIRANHA_DETAIL_POW_CACHE_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "../math.hpp"
+#include "../mp_integer.hpp"
+#include "../symbol.hpp"
+#include "../symbol_set.hpp"
+
+// Cache of the powers of the values with which the symbols of a series are evaluated. For each symbol,
+// the cache stores the evaluation value and a table of its non-negative powers, extended on demand up to the
+// largest exponent requested. The entries of the tables are computed with math::pow(), so that the cached
+// powers are identical to the ones computed by the evaluation methods of the keys. Negative exponents,
+// exponents above the size limit of the tables and non-integral exponents are not cached.
+// The cache is not thread-safe: parallel evaluation uses one cache per thread.
+
+namespace piranha { namespace detail {
+
+template <typename T, typename R>
+class pow_cache
+{
+	public:
+		using size_type = symbol_set::size_type;
+		// Maximum number of cached powers for each symbol.
+		static const unsigned long long max_table_size = 256u;
+	private:
+		// Powers are tabulated only for integral exponents, including piranha::integer.
+		template <typename E>
+		using is_tabulable = std::integral_constant<bool,std::is_integral<E>::value || std::is_same<E,integer>::value>;
+		template <typename E>
+		using pow_type = decltype(math::pow(std::declval<const T &>(),std::declval<const E &>()));
+		template <typename E, typename std::enable_if<std::is_integral<E>::value && std::is_signed<E>::value,int>::type = 0>
+		static bool in_table(const E &e)
+		{
+			return e >= E(0) && static_cast<unsigned long long>(e) < max_table_size;
+		}
+		template <typename E, typename std::enable_if<std::is_integral<E>::value && !std::is_signed<E>::value,int>::type = 0>
+		static bool in_table(const E &e)
+		{
+			return static_cast<unsigned long long>(e) < max_table_size;
+		}
+		template <typename E, typename std::enable_if<std::is_same<E,integer>::value,int>::type = 0>
+		static bool in_table(const E &e)
+		{
+			return e.sign() >= 0 && e < max_table_size;
+		}
+		template <typename E>
+		void multiply_pow_impl(R &retval, const size_type &i, const E &e, const std::true_type &)
+		{
+			if (!in_table(e)) {
+				retval *= math::pow(m_values[i],e);
+				return;
+			}
+			auto &table = m_tables[i];
+			const auto idx = static_cast<std::size_t>(e);
+			while (table.size() <= idx) {
+				table.push_back(math::pow(m_values[i],static_cast<E>(table.size())));
+			}
+			retval *= table[idx];
+		}
+		template <typename E>
+		void multiply_pow_impl(R &retval, const size_type &i, const E &e, const std::false_type &)
+		{
+			retval *= math::pow(m_values[i],e);
+		}
+	public:
+		// Build the cache from the evaluation dictionary of a series with arguments args.
+		explicit pow_cache(const std::unordered_map<symbol,T> &dict, const symbol_set &args):m_tables(args.size())
+		{
+			m_values.reserve(args.size());
+			const auto it_f = dict.end();
+			for (const auto &s: args) {
+				const auto it = dict.find(s);
+				if (unlikely(it == it_f)) {
+					piranha_throw(std::invalid_argument,
+						std::string("cannot evaluate series: symbol \'") + s.get_name() +
+						"\' does not appear in dictionary");
+				}
+				m_values.push_back(it->second);
+			}
+		}
+		// Number of symbols in the cache.
+		size_type size() const
+		{
+			return static_cast<size_type>(m_values.size());
+		}
+		// Multiply retval in place by the value of the i-th symbol raised to e.
+		template <typename E>
+		void multiply_pow(R &retval, const size_type &i, const E &e)
+		{
+			piranha_assert(i < m_values.size());
+			multiply_pow_impl(retval,i,e,std::integral_constant<bool,is_tabulable<E>::value &&
+				std::is_same<pow_type<E>,R>::value>());
+		}
+	private:
+		std::vector<T>			m_values;
+		std::vector<std::vector<R>>	m_tables;
+};
+
+template <typename T, typename R>
+const unsigned long long pow_cache<T,R>::max_table_size;
+
+}}
+
+#endif
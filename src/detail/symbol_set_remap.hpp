@@ -0,0 +1,112 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_DETAIL_SYMBOL_SET_REMAP_HPP
+#define PIRANHA_DETAIL_SYMBOL_SET_REMAP_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "../config.hpp"
+#include "../exceptions.hpp"
+#include "../symbol_set.hpp"
+
+// Index maps between symbol sets, used when the arguments of the keys are merged or trimmed.
+// The maps are cached, per thread, by the pair of symbol sets: when all the keys of a series are
+// remapped, the map is built (and the symbol sets validated) only once, and each key then
+// requires only a gather operation. Checking the cache requires only the comparison of the
+// pointers stored in the symbols, with no string comparison.
+
+namespace piranha { namespace detail {
+
+typedef std::vector<symbol_set::size_type> ss_remap_type;
+
+struct ss_remap_cache
+{
+	bool		m_valid = false;
+	symbol_set	m_a;
+	symbol_set	m_b;
+	ss_remap_type	m_map;
+};
+
+// Merging of orig_args into new_args. For each symbol in new_args, the returned map contains the index
+// of the same symbol in orig_args, or orig_args.size() if the symbol does not appear in orig_args.
+inline const ss_remap_type &ss_merge_remap(const symbol_set &orig_args, const symbol_set &new_args)
+{
+	static thread_local ss_remap_cache cache;
+	if (cache.m_valid && cache.m_a == orig_args && cache.m_b == new_args) {
+		return cache.m_map;
+	}
+	// NOTE: here and elsewhere (i.e., kronecker keys) the check on new_args.size() <= orig_args.size()
+	// is not redundant with the std::includes check; indeed it actually checks that the new args are
+	// _more_ than the old args (whereas with just the std::includes check identical orig_args and new_args
+	// would be allowed).
+	if (unlikely(new_args.size() <= orig_args.size() ||
+		!std::includes(new_args.begin(),new_args.end(),orig_args.begin(),orig_args.end())))
+	{
+		piranha_throw(std::invalid_argument,"invalid argument(s) for symbol set merging");
+	}
+	ss_remap_type map;
+	map.reserve(new_args.size());
+	symbol_set::size_type i = 0u;
+	for (const auto &s: new_args) {
+		if (i < orig_args.size() && orig_args[i] == s) {
+			map.push_back(i);
+			++i;
+		} else {
+			map.push_back(orig_args.size());
+		}
+	}
+	piranha_assert(i == orig_args.size());
+	// Invalidate first, so that the cache is never left in an inconsistent state in case of exceptions.
+	cache.m_valid = false;
+	cache.m_a = orig_args;
+	cache.m_b = new_args;
+	cache.m_map = std::move(map);
+	cache.m_valid = true;
+	return cache.m_map;
+}
+
+// Trimming of trim_args from orig_args. The returned map contains, in ascending order, the indices of
+// the symbols in orig_args not appearing in trim_args.
+inline const ss_remap_type &ss_trim_remap(const symbol_set &trim_args, const symbol_set &orig_args)
+{
+	static thread_local ss_remap_cache cache;
+	if (cache.m_valid && cache.m_a == trim_args && cache.m_b == orig_args) {
+		return cache.m_map;
+	}
+	ss_remap_type map;
+	for (symbol_set::size_type i = 0u; i < orig_args.size(); ++i) {
+		if (!std::binary_search(trim_args.begin(),trim_args.end(),orig_args[i])) {
+			map.push_back(i);
+		}
+	}
+	cache.m_valid = false;
+	cache.m_a = trim_args;
+	cache.m_b = orig_args;
+	cache.m_map = std::move(map);
+	cache.m_valid = true;
+	return cache.m_map;
+}
+
+}}
+
+#endif
@@ -0,0 +1,111 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_DETAIL_VECTOR_KERNELS_HPP
+#define PIRANHA_DETAIL_VECTOR_KERNELS_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+// Element-wise kernels over contiguous buffers of integral values, used by the vector-like containers
+// and by the monomial class. The loops are branch-free and operate on raw pointers with unsigned arithmetic,
+// so that the compiler is able to vectorise them for the instruction set selected at build time.
+
+namespace piranha { namespace detail {
+
+// Types for which the kernels are available.
+template <typename T>
+using vk_enabled = std::integral_constant<bool,std::is_integral<T>::value && !std::is_same<T,bool>::value>;
+
+// Overflow flag for the addition ua + ub = ur, computed in unsigned arithmetic: for signed types,
+// the sign bit of the flag is set if the operands have the same sign and the result has a different sign.
+template <typename T, typename U>
+inline U vk_add_overflow_flag(const U &ua, const U &ub, const U &ur, typename std::enable_if<std::is_signed<T>::value>::type * = nullptr)
+{
+	return static_cast<U>(static_cast<U>(ua ^ ur) & static_cast<U>(ub ^ ur));
+}
+
+template <typename T, typename U>
+inline U vk_add_overflow_flag(const U &ua, const U &, const U &ur, typename std::enable_if<!std::is_signed<T>::value>::type * = nullptr)
+{
+	return static_cast<U>(ur < ua);
+}
+
+template <typename T, typename U>
+inline bool vk_check_overflow_flag(const U &flag, typename std::enable_if<std::is_signed<T>::value>::type * = nullptr)
+{
+	return (flag >> (std::numeric_limits<U>::digits - 1)) != 0u;
+}
+
+template <typename T, typename U>
+inline bool vk_check_overflow_flag(const U &flag, typename std::enable_if<!std::is_signed<T>::value>::type * = nullptr)
+{
+	return flag != 0u;
+}
+
+// Element-wise addition out = a + b of buffers of the given size. The return value is false if any of the
+// additions overflowed (in which case the content of out is unspecified). out can coincide with a or b.
+template <typename T>
+inline bool vector_add_checked(T *out, const T *a, const T *b, const std::size_t &size)
+{
+	static_assert(vk_enabled<T>::value,"Invalid type.");
+	typedef typename std::make_unsigned<T>::type uint_type;
+	// NOTE: the overflow condition is accumulated in a flag instead of being checked element by element,
+	// in order to keep the loop free of branches.
+	uint_type flag(0u);
+	for (std::size_t i = 0u; i < size; ++i) {
+		const uint_type ua = static_cast<uint_type>(a[i]), ub = static_cast<uint_type>(b[i]),
+			ur = static_cast<uint_type>(ua + ub);
+		flag = static_cast<uint_type>(flag | vk_add_overflow_flag<T>(ua,ub,ur));
+		out[i] = static_cast<T>(ur);
+	}
+	return !vk_check_overflow_flag<T>(flag);
+}
+
+// Equality of buffers of the given size. All the elements are inspected, without early exit.
+template <typename T>
+inline bool vector_equal(const T *a, const T *b, const std::size_t &size)
+{
+	static_assert(vk_enabled<T>::value,"Invalid type.");
+	typedef typename std::make_unsigned<T>::type uint_type;
+	uint_type acc(0u);
+	for (std::size_t i = 0u; i < size; ++i) {
+		acc = static_cast<uint_type>(acc | static_cast<uint_type>(static_cast<uint_type>(a[i]) ^ static_cast<uint_type>(b[i])));
+	}
+	return acc == 0u;
+}
+
+// Sum of the elements of a buffer, computed modulo 2**N (N being the bit width of T).
+template <typename T>
+inline T vector_sum(const T *a, const std::size_t &size)
+{
+	static_assert(vk_enabled<T>::value,"Invalid type.");
+	typedef typename std::make_unsigned<T>::type uint_type;
+	uint_type acc(0u);
+	for (std::size_t i = 0u; i < size; ++i) {
+		acc = static_cast<uint_type>(acc + static_cast<uint_type>(a[i]));
+	}
+	return static_cast<T>(acc);
+}
+
+}}
+
+#endif
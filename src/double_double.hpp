@@ -0,0 +1,1568 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_DOUBLE_DOUBLE_HPP
+#define PIRANHA_DOUBLE_DOUBLE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "config.hpp"
+#include "exceptions.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "mp_rational.hpp"
+#include "real.hpp"
+#include "type_traits.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Types interoperable with double_double.
+template <typename T>
+struct is_double_double_interoperable_type
+{
+	static const bool value = is_mp_integer_interoperable_type<T>::value ||
+		is_mp_integer<T>::value || is_mp_rational<T>::value;
+};
+
+}
+
+/// Double-double floating-point class.
+/**
+ * This class represents floating-point numbers as the unevaluated sum of two \p double values, \p hi and \p lo,
+ * with <tt>|lo| <= ulp(hi) / 2</tt>. The resulting format has a significand of (at least) 106 bits and the same exponent range
+ * as \p double. Contrary to piranha::real, the storage is fixed-size and inline, and all the basic arithmetic operations are implemented
+ * with a handful of hardware floating-point operations via the error-free transformations of Knuth and Dekker. This makes
+ * piranha::double_double a much faster (but less flexible) alternative to piranha::real when the required accuracy is
+ * close to that of the IEEE 754 quadruple-precision format.
+ *
+ * The basic arithmetic operations are not correctly rounded, but their relative error is a small multiple of
+ * \f$ 2^{-106} \f$. Operations that would overflow the range of \p double at an intermediate stage
+ * (e.g., multiplications involving values larger than about \f$ 2^{996} \f$ on platforms without a fast \p std::fma())
+ * are not guaranteed to produce meaningful results.
+ *
+ * \section interop Interoperability with other types
+ *
+ * This class interoperates with the same types as piranha::mp_integer and piranha::mp_rational,
+ * plus piranha::mp_integer and piranha::mp_rational themselves. The result of binary operations involving
+ * interoperable types is always piranha::double_double.
+ *
+ * Binary operations are also provided between piranha::double_double and piranha::real: in this case
+ * the piranha::double_double operand is converted to piranha::real, and the result is piranha::real.
+ *
+ * \section exception_safety Exception safety guarantee
+ *
+ * Unless noted otherwise, this class provides the strong exception safety guarantee for all operations.
+ * All the operations that do not involve piranha::mp_integer, piranha::mp_rational, piranha::real or strings
+ * are \p noexcept.
+ *
+ * \section move_semantics Move semantics
+ *
+ * Move semantics is equivalent to copy semantics.
+ *
+ * @see http://crd-legacy.lbl.gov/~dhbailey/mpdist/
+ *
+ * @author Francesco Biscani (bluescarni@gmail.com)
+ */
+// NOTES:
+// - the error-free transformations assume round-to-nearest and no excess precision on intermediate results
+//   (i.e., SSE2 arithmetic on x86). We also rely on the compiler not contracting multiplications and additions
+//   into fused operations behind our back, which is the default in ISO C++ mode.
+// - the trigonometric functions use a simple Cody-Waite reduction followed by Taylor series. If they show up
+//   in profiles, we can switch to tabulated reduction as done in the QD library.
+class double_double
+{
+		// Shortcut for interop type detector.
+		template <typename T>
+		using is_interoperable_type = detail::is_double_double_interoperable_type<T>;
+		// Enabler for generic ctor.
+		template <typename T>
+		using generic_ctor_enabler = typename std::enable_if<is_interoperable_type<T>::value,int>::type;
+		// Enabler for conversion operator.
+		template <typename T>
+		using cast_enabler = typename std::enable_if<is_interoperable_type<T>::value || std::is_same<T,real>::value,int>::type;
+		// Enabler for in-place arithmetic operations.
+		template <typename T>
+		using in_place_enabler = cast_enabler<T>;
+		// Enabler for in-place arithmetic operations with interop on the left.
+		template <typename T>
+		using generic_in_place_enabler = typename std::enable_if<(is_interoperable_type<T>::value || std::is_same<T,real>::value) &&
+			!std::is_const<T>::value,int>::type;
+		// Error-free transformations.
+		// NOTE: the inputs are passed by value as they might alias the outputs.
+		// Sum of two doubles: s + e == a + b exactly.
+		static void two_sum(double &s, double &e, double a, double b) noexcept
+		{
+			s = a + b;
+			const double bb = s - a;
+			e = (a - (s - bb)) + (b - bb);
+		}
+		// Same as above, requires |a| >= |b|.
+		static void quick_two_sum(double &s, double &e, double a, double b) noexcept
+		{
+			s = a + b;
+			e = b - (s - a);
+		}
+#if !defined(FP_FAST_FMA)
+		// Dekker's splitting of a into two non-overlapping halves of 26 bits each.
+		static void split(double &hi, double &lo, const double &a) noexcept
+		{
+			const double t = 134217729. * a;
+			hi = t - (t - a);
+			lo = a - hi;
+		}
+#endif
+		// Product of two doubles: p + e == a * b exactly.
+		static void two_prod(double &p, double &e, double a, double b) noexcept
+		{
+			p = a * b;
+#if defined(FP_FAST_FMA)
+			e = std::fma(a,b,-p);
+#else
+			double a_hi, a_lo, b_hi, b_lo;
+			split(a_hi,a_lo,a);
+			split(b_hi,b_lo,b);
+			e = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+#endif
+		}
+		// Non-finite values are stored with a zero low part, so that the usual IEEE semantics is preserved.
+		// This needs to be checked after the first error-free transformation of each operation, as the low
+		// parts would otherwise propagate NaNs.
+		bool handle_non_finite(const double &x) noexcept
+		{
+			if (unlikely(!std::isfinite(x))) {
+				m_hi = x;
+				m_lo = 0.;
+				return true;
+			}
+			return false;
+		}
+		// Normalisation of the final result of an operation.
+		void normalise(const double &a, const double &b) noexcept
+		{
+			quick_two_sum(m_hi,m_lo,a,b);
+			if (unlikely(!std::isfinite(m_hi))) {
+				m_lo = 0.;
+			}
+		}
+		// Basic arithmetics.
+		void dd_add(const double_double &other) noexcept
+		{
+			double s1, s2, t1, t2;
+			two_sum(s1,s2,m_hi,other.m_hi);
+			if (handle_non_finite(s1)) {
+				return;
+			}
+			two_sum(t1,t2,m_lo,other.m_lo);
+			s2 += t1;
+			quick_two_sum(s1,s2,s1,s2);
+			s2 += t2;
+			normalise(s1,s2);
+		}
+		void dd_mul(const double_double &other) noexcept
+		{
+			double p1, p2;
+			two_prod(p1,p2,m_hi,other.m_hi);
+			if (handle_non_finite(p1)) {
+				return;
+			}
+			p2 += m_hi * other.m_lo + m_lo * other.m_hi;
+			normalise(p1,p2);
+		}
+		void dd_div(const double_double &other) noexcept
+		{
+			if (unlikely(other.m_hi == 0. || !std::isfinite(other.m_hi) || !std::isfinite(m_hi))) {
+				m_hi /= other.m_hi;
+				m_lo = 0.;
+				return;
+			}
+			// Long division, one double at a time.
+			const double q1 = m_hi / other.m_hi;
+			double_double r(*this), tmp(other);
+			tmp *= q1;
+			r.dd_sub(tmp);
+			const double q2 = r.m_hi / other.m_hi;
+			tmp = other;
+			tmp *= q2;
+			r.dd_sub(tmp);
+			const double q3 = r.m_hi / other.m_hi;
+			double s1, s2;
+			quick_two_sum(s1,s2,q1,q2);
+			m_hi = s1;
+			m_lo = s2;
+			dd_add(double_double(q3));
+		}
+		void dd_sub(const double_double &other) noexcept
+		{
+			dd_add(-other);
+		}
+		// Construction.
+		template <typename T, typename std::enable_if<std::is_same<T,float>::value || std::is_same<T,double>::value,int>::type = 0>
+		void construct_from_generic(const T &x) noexcept
+		{
+			m_hi = static_cast<double>(x);
+			m_lo = 0.;
+		}
+		template <typename T, typename std::enable_if<std::is_same<T,long double>::value,int>::type = 0>
+		void construct_from_generic(const T &x) noexcept
+		{
+			m_hi = static_cast<double>(x);
+			m_lo = std::isfinite(m_hi) ? static_cast<double>(x - static_cast<long double>(m_hi)) : 0.;
+		}
+		// NOTE: integers not larger than 2**53 in absolute value are represented exactly by the high part.
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,int>::type = 0>
+		static bool fits_in_hi(const T &n) noexcept
+		{
+			return static_cast<long long>(n) <= (1ll << 53) && static_cast<long long>(n) >= -(1ll << 53);
+		}
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,int>::type = 0>
+		static bool fits_in_hi(const T &n) noexcept
+		{
+			return static_cast<unsigned long long>(n) <= (1ull << 53);
+		}
+		template <typename T, typename std::enable_if<std::is_integral<T>::value,int>::type = 0>
+		void construct_from_generic(const T &n)
+		{
+			if (fits_in_hi(n)) {
+				m_hi = static_cast<double>(n);
+				m_lo = 0.;
+			} else {
+				construct_from_generic(integer(n));
+			}
+		}
+		template <typename T, typename std::enable_if<detail::is_mp_integer<T>::value || detail::is_mp_rational<T>::value,int>::type = 0>
+		void construct_from_generic(const T &x)
+		{
+			construct_from_real(real{x});
+		}
+		void construct_from_real(const real &r)
+		{
+			m_hi = static_cast<double>(r);
+			if (std::isfinite(m_hi)) {
+				m_lo = static_cast<double>(r - real{m_hi,r.get_prec()});
+			} else {
+				m_lo = 0.;
+			}
+		}
+		// Conversion.
+		template <typename T>
+		typename std::enable_if<std::is_same<T,bool>::value,T>::type convert_to_impl() const noexcept
+		{
+			return m_hi != 0.;
+		}
+		template <typename T>
+		typename std::enable_if<std::is_same<T,float>::value || std::is_same<T,double>::value,T>::type convert_to_impl() const noexcept
+		{
+			return static_cast<T>(m_hi + m_lo);
+		}
+		template <typename T>
+		typename std::enable_if<std::is_same<T,long double>::value,T>::type convert_to_impl() const noexcept
+		{
+			return static_cast<long double>(m_hi) + static_cast<long double>(m_lo);
+		}
+		template <typename T>
+		typename std::enable_if<detail::is_mp_integer<T>::value,T>::type convert_to_impl() const
+		{
+			if (unlikely(!std::isfinite(m_hi))) {
+				piranha_throw(std::overflow_error,"cannot convert non-finite double_double to an integral value");
+			}
+			// NOTE: if the high part is not integral, then it is at least one ulp away from the nearest
+			// integer and the low part cannot change the result of the truncation. Otherwise, the
+			// truncation of the sum is determined by the low part, rounded towards the high part.
+			const double t_hi = std::trunc(m_hi);
+			T retval(t_hi);
+			if (t_hi == m_hi) {
+				retval += T((m_hi > 0.) ? std::floor(m_lo) : std::ceil(m_lo));
+			}
+			return retval;
+		}
+		template <typename T>
+		typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value,T>::type convert_to_impl() const
+		{
+			return static_cast<T>(convert_to_impl<integer>());
+		}
+		template <typename T>
+		typename std::enable_if<detail::is_mp_rational<T>::value,T>::type convert_to_impl() const
+		{
+			return T(m_hi) + T(m_lo);
+		}
+		template <typename T>
+		typename std::enable_if<std::is_same<T,real>::value,T>::type convert_to_impl() const
+		{
+			real retval{m_hi};
+			retval += m_lo;
+			return retval;
+		}
+		// Binary operations.
+		template <typename T, typename U>
+		using binary_op_enabler = typename std::enable_if<
+			(std::is_same<T,double_double>::value && is_interoperable_type<U>::value) ||
+			(std::is_same<U,double_double>::value && is_interoperable_type<T>::value) ||
+			(std::is_same<T,double_double>::value && std::is_same<U,double_double>::value),int>::type;
+		template <typename T, typename U>
+		using real_op_enabler = typename std::enable_if<
+			(std::is_same<T,double_double>::value && std::is_same<U,real>::value) ||
+			(std::is_same<U,double_double>::value && std::is_same<T,real>::value),int>::type;
+		// Convert argument to the type of the operation.
+		template <typename T>
+		static const double_double &to_dd(const T &x, typename std::enable_if<std::is_same<T,double_double>::value>::type * = nullptr) noexcept
+		{
+			return x;
+		}
+		template <typename T>
+		static double_double to_dd(const T &x, typename std::enable_if<!std::is_same<T,double_double>::value>::type * = nullptr)
+		{
+			return double_double(x);
+		}
+		template <typename T>
+		static const real &to_real(const T &x, typename std::enable_if<std::is_same<T,real>::value>::type * = nullptr) noexcept
+		{
+			return x;
+		}
+		template <typename T>
+		static real to_real(const T &x, typename std::enable_if<std::is_same<T,double_double>::value>::type * = nullptr)
+		{
+			return static_cast<real>(x);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static double_double binary_add(const T &x, const U &y)
+		{
+			double_double retval(to_dd(x));
+			retval.dd_add(to_dd(y));
+			return retval;
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static real binary_add(const T &x, const U &y)
+		{
+			return to_real(x) + to_real(y);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static double_double binary_sub(const T &x, const U &y)
+		{
+			double_double retval(to_dd(x));
+			retval.dd_sub(to_dd(y));
+			return retval;
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static real binary_sub(const T &x, const U &y)
+		{
+			return to_real(x) - to_real(y);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static double_double binary_mul(const T &x, const U &y)
+		{
+			double_double retval(to_dd(x));
+			retval.dd_mul(to_dd(y));
+			return retval;
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static real binary_mul(const T &x, const U &y)
+		{
+			return to_real(x) * to_real(y);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static double_double binary_div(const T &x, const U &y)
+		{
+			double_double retval(to_dd(x));
+			retval.dd_div(to_dd(y));
+			return retval;
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static real binary_div(const T &x, const U &y)
+		{
+			return to_real(x) / to_real(y);
+		}
+		// Comparisons.
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static bool binary_equality(const T &x, const U &y)
+		{
+			const double_double &a = to_dd(x), &b = to_dd(y);
+			return a.m_hi == b.m_hi && a.m_lo == b.m_lo;
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static bool binary_equality(const T &x, const U &y)
+		{
+			return to_real(x) == to_real(y);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static bool binary_less_than(const T &x, const U &y)
+		{
+			const double_double &a = to_dd(x), &b = to_dd(y);
+			return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo < b.m_lo);
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static bool binary_less_than(const T &x, const U &y)
+		{
+			return to_real(x) < to_real(y);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static bool binary_leq(const T &x, const U &y)
+		{
+			const double_double &a = to_dd(x), &b = to_dd(y);
+			return a.m_hi < b.m_hi || (a.m_hi == b.m_hi && a.m_lo <= b.m_lo);
+		}
+		template <typename T, typename U, real_op_enabler<T,U> = 0>
+		static bool binary_leq(const T &x, const U &y)
+		{
+			return to_real(x) <= to_real(y);
+		}
+		// Trigonometric functions.
+		// Taylor series of sine and cosine for |x| <= pi / 4.
+		static void sin_cos_taylor(double_double &s, double_double &c, const double_double &x)
+		{
+			const double_double x2 = -(x * x);
+			const double eps = std::ldexp(1.,-108);
+			double_double term(x);
+			s = x;
+			for (int n = 2; std::abs(term.m_hi) > eps; n += 2) {
+				term *= x2;
+				term /= double_double(n * (n + 1));
+				s += term;
+			}
+			term = double_double(1);
+			c = term;
+			for (int n = 1; std::abs(term.m_hi) > eps; n += 2) {
+				term *= x2;
+				term /= double_double(n * (n + 1));
+				c += term;
+			}
+		}
+		// Reduce modulo pi / 2 and compute sine and cosine.
+		void sin_cos(double_double &s, double_double &c) const
+		{
+			if (unlikely(!std::isfinite(m_hi))) {
+				s = c = double_double(std::numeric_limits<double>::quiet_NaN());
+				return;
+			}
+			// NOTE: above this threshold the Cody-Waite reduction with a three-part pi / 2 starts
+			// losing accuracy, and we fall back to MPFR.
+			if (unlikely(std::abs(m_hi) > 1E15)) {
+				const real r = static_cast<real>(*this);
+				s = double_double(r.sin());
+				c = double_double(r.cos());
+				return;
+			}
+			// The three parts of pi / 2.
+			const double p1 = 1.5707963267948966, p2 = 6.123233995736766e-17, p3 = -1.4973849048591698e-33;
+			const double q = std::nearbyint(m_hi / p1);
+			double_double r(*this), tmp;
+			two_prod(tmp.m_hi,tmp.m_lo,q,p1);
+			r -= tmp;
+			two_prod(tmp.m_hi,tmp.m_lo,q,p2);
+			r -= tmp;
+			r -= double_double(q * p3);
+			double_double sr, cr;
+			sin_cos_taylor(sr,cr,r);
+			const long long quadrant = ((static_cast<long long>(q) % 4) + 4) % 4;
+			switch (quadrant) {
+				case 0:
+					s = sr;
+					c = cr;
+					break;
+				case 1:
+					s = cr;
+					c = -sr;
+					break;
+				case 2:
+					s = -sr;
+					c = -cr;
+					break;
+				default:
+					s = -cr;
+					c = sr;
+			}
+		}
+		// Exponentiation by squaring.
+		static double_double ipow(const double_double &base, unsigned long long n) noexcept
+		{
+			double_double retval(1), b(base);
+			while (n) {
+				if (n & 1u) {
+					retval *= b;
+				}
+				n >>= 1u;
+				if (n) {
+					b *= b;
+				}
+			}
+			return retval;
+		}
+		template <typename T>
+		static double_double pow_integral(const double_double &base, const T &n)
+		{
+			if (n >= T(0)) {
+				return ipow(base,static_cast<unsigned long long>(n));
+			}
+			// NOTE: go through the absolute value via integer in order to avoid overflow
+			// on the minimum negative value.
+			return double_double(1) / ipow(base,static_cast<unsigned long long>(-integer(n)));
+		}
+	public:
+		/// Default constructor.
+		/**
+		 * Will initialise the number to zero.
+		 */
+		double_double() noexcept : m_hi(0.),m_lo(0.) {}
+		/// Defaulted copy constructor.
+		double_double(const double_double &) = default;
+		/// Defaulted move constructor.
+		double_double(double_double &&) = default;
+		/// Generic constructor.
+		/**
+		 * \note
+		 * This constructor is enabled only if \p T is an \ref interop "interoperable type".
+		 *
+		 * Values that cannot be represented exactly will be rounded to the nearest double-double value,
+		 * with a relative error not larger than \f$ 2^{-106} \f$.
+		 *
+		 * @param[in] x object used to construct \p this.
+		 *
+		 * @throws unspecified any exception thrown by the constructor of piranha::real from piranha::mp_integer
+		 * or piranha::mp_rational.
+		 */
+		template <typename T, typename = generic_ctor_enabler<T>>
+		explicit double_double(const T &x)
+		{
+			construct_from_generic(x);
+		}
+		/// Constructor from piranha::real.
+		/**
+		 * The value of \p r will be rounded to the nearest double-double value.
+		 *
+		 * @param[in] r piranha::real used to construct \p this.
+		 *
+		 * @throws unspecified any exception thrown by the arithmetic operators of piranha::real.
+		 */
+		explicit double_double(const real &r)
+		{
+			construct_from_real(r);
+		}
+		/// Constructor from C string.
+		/**
+		 * The string is parsed by piranha::real with the default precision, and then rounded to double-double.
+		 *
+		 * @param[in] str string representation of the number.
+		 *
+		 * @throws unspecified any exception thrown by the constructor of piranha::real from string.
+		 */
+		explicit double_double(const char *str)
+		{
+			construct_from_real(real{str});
+		}
+		/// Constructor from C++ string.
+		/**
+		 * Equivalent to the constructor from C string.
+		 *
+		 * @param[in] str string representation of the number.
+		 *
+		 * @throws unspecified any exception thrown by the constructor from C string.
+		 */
+		explicit double_double(const std::string &str)
+		{
+			construct_from_real(real{str});
+		}
+		/// Defaulted destructor.
+		~double_double() = default;
+		/// Defaulted copy-assignment operator.
+		double_double &operator=(const double_double &) = default;
+		/// Defaulted move-assignment operator.
+		double_double &operator=(double_double &&) = default;
+		/// Generic assignment operator.
+		/**
+		 * \note
+		 * This assignment operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in] x assignment argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the corresponding constructor.
+		 */
+		template <typename T, cast_enabler<T> = 0>
+		double_double &operator=(const T &x)
+		{
+			return (*this = double_double(x));
+		}
+		/// High part.
+		/**
+		 * @return the high part of \p this, i.e., the \p double closest to the value of \p this.
+		 */
+		double hi() const noexcept
+		{
+			return m_hi;
+		}
+		/// Low part.
+		/**
+		 * @return the low part of \p this.
+		 */
+		double lo() const noexcept
+		{
+			return m_lo;
+		}
+		/// Conversion operator.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * Conversion to integral types and to piranha::mp_integer truncates. Conversion to piranha::mp_rational
+		 * is exact, conversion to piranha::real rounds to piranha::real::default_prec bits.
+		 *
+		 * @return the value of \p this converted to type \p T.
+		 *
+		 * @throws std::overflow_error if a non-finite value is converted to an integral type, or if the conversion
+		 * to a C++ integral type overflows.
+		 * @throws unspecified any exception thrown by the constructors of piranha::mp_rational and piranha::real.
+		 */
+		template <typename T, cast_enabler<T> = 0>
+		explicit operator T() const
+		{
+			return convert_to_impl<T>();
+		}
+		/// Negate in-place.
+		void negate() noexcept
+		{
+			m_hi = -m_hi;
+			m_lo = -m_lo;
+		}
+		/// Test for zero.
+		/**
+		 * @return \p true if \p this is zero, \p false otherwise.
+		 */
+		bool is_zero() const noexcept
+		{
+			return m_hi == 0.;
+		}
+		/// Test for NaN.
+		/**
+		 * @return \p true if \p this is NaN, \p false otherwise.
+		 */
+		bool is_nan() const noexcept
+		{
+			return std::isnan(m_hi);
+		}
+		/// Test for infinity.
+		/**
+		 * @return \p true if \p this is infinite, \p false otherwise.
+		 */
+		bool is_inf() const noexcept
+		{
+			return std::isinf(m_hi);
+		}
+		/// Sign.
+		/**
+		 * @return 1 if <tt>this > 0</tt>, 0 if <tt>this == 0</tt> and -1 if <tt>this < 0</tt>. If \p this is NaN, zero will be returned.
+		 */
+		int sign() const noexcept
+		{
+			return (m_hi > 0.) ? 1 : ((m_hi < 0.) ? -1 : 0);
+		}
+		/// Absolute value.
+		/**
+		 * @return absolute value of \p this.
+		 */
+		double_double abs() const noexcept
+		{
+			return (m_hi < 0.) ? -*this : *this;
+		}
+		/// In-place addition.
+		/**
+		 * @param[in] other argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &operator+=(const double_double &other) noexcept
+		{
+			dd_add(other);
+			return *this;
+		}
+		/// Generic in-place addition.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the corresponding binary operator or by
+		 * the constructor from \p T.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		double_double &operator+=(const T &x)
+		{
+			return (*this = static_cast<double_double>(*this + x));
+		}
+		/// Generic in-place addition with piranha::double_double.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is a non-const \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in,out] x first argument.
+		 * @param[in] d second argument.
+		 *
+		 * @return reference to \p x.
+		 *
+		 * @throws unspecified any exception resulting from the binary operator or by casting piranha::double_double to \p T.
+		 */
+		template <typename T, generic_in_place_enabler<T> = 0>
+		friend T &operator+=(T &x, const double_double &d)
+		{
+			return x = static_cast<T>(x + d);
+		}
+		/// Generic binary addition involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::double_double and \p U is an \ref interop "interoperable type" or piranha::real,
+		 * - \p U is piranha::double_double and \p T is an \ref interop "interoperable type" or piranha::real,
+		 * - both \p T and \p U are piranha::double_double.
+		 *
+		 * The return type is piranha::real if one of the arguments is piranha::real, piranha::double_double otherwise.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x + y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator+(const T &x, const U &y) -> decltype(double_double::binary_add(x,y))
+		{
+			return binary_add(x,y);
+		}
+		/// Identity operator.
+		/**
+		 * @return copy of \p this.
+		 */
+		double_double operator+() const noexcept
+		{
+			return *this;
+		}
+		/// Prefix increment.
+		/**
+		 * @return reference to \p this after the increment.
+		 */
+		double_double &operator++() noexcept
+		{
+			return operator+=(double_double(1));
+		}
+		/// Suffix increment.
+		/**
+		 * @return copy of \p this before the increment.
+		 */
+		double_double operator++(int) noexcept
+		{
+			const double_double retval(*this);
+			++(*this);
+			return retval;
+		}
+		/// In-place subtraction.
+		/**
+		 * @param[in] other argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &operator-=(const double_double &other) noexcept
+		{
+			dd_sub(other);
+			return *this;
+		}
+		/// Generic in-place subtraction.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the corresponding binary operator or by
+		 * the constructor from \p T.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		double_double &operator-=(const T &x)
+		{
+			return (*this = static_cast<double_double>(*this - x));
+		}
+		/// Generic in-place subtraction with piranha::double_double.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is a non-const \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in,out] x first argument.
+		 * @param[in] d second argument.
+		 *
+		 * @return reference to \p x.
+		 *
+		 * @throws unspecified any exception resulting from the binary operator or by casting piranha::double_double to \p T.
+		 */
+		template <typename T, generic_in_place_enabler<T> = 0>
+		friend T &operator-=(T &x, const double_double &d)
+		{
+			return x = static_cast<T>(x - d);
+		}
+		/// Generic binary subtraction involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::double_double and \p U is an \ref interop "interoperable type" or piranha::real,
+		 * - \p U is piranha::double_double and \p T is an \ref interop "interoperable type" or piranha::real,
+		 * - both \p T and \p U are piranha::double_double.
+		 *
+		 * The return type is piranha::real if one of the arguments is piranha::real, piranha::double_double otherwise.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x - y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator-(const T &x, const U &y) -> decltype(double_double::binary_sub(x,y))
+		{
+			return binary_sub(x,y);
+		}
+		/// Negated copy.
+		/**
+		 * @return copy of \p -this.
+		 */
+		double_double operator-() const noexcept
+		{
+			double_double retval(*this);
+			retval.negate();
+			return retval;
+		}
+		/// Prefix decrement.
+		/**
+		 * @return reference to \p this after the decrement.
+		 */
+		double_double &operator--() noexcept
+		{
+			return operator-=(double_double(1));
+		}
+		/// Suffix decrement.
+		/**
+		 * @return copy of \p this before the decrement.
+		 */
+		double_double operator--(int) noexcept
+		{
+			const double_double retval(*this);
+			--(*this);
+			return retval;
+		}
+		/// In-place multiplication.
+		/**
+		 * @param[in] other argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &operator*=(const double_double &other) noexcept
+		{
+			dd_mul(other);
+			return *this;
+		}
+		/// In-place multiplication by \p double.
+		/**
+		 * This overload saves a few floating-point operations with respect to the multiplication
+		 * by piranha::double_double.
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &operator*=(const double &x) noexcept
+		{
+			double p1, p2;
+			two_prod(p1,p2,m_hi,x);
+			if (handle_non_finite(p1)) {
+				return *this;
+			}
+			p2 += m_lo * x;
+			normalise(p1,p2);
+			return *this;
+		}
+		/// Generic in-place multiplication.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the corresponding binary operator or by
+		 * the constructor from \p T.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		double_double &operator*=(const T &x)
+		{
+			return (*this = static_cast<double_double>(*this * x));
+		}
+		/// Generic in-place multiplication with piranha::double_double.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is a non-const \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in,out] x first argument.
+		 * @param[in] d second argument.
+		 *
+		 * @return reference to \p x.
+		 *
+		 * @throws unspecified any exception resulting from the binary operator or by casting piranha::double_double to \p T.
+		 */
+		template <typename T, generic_in_place_enabler<T> = 0>
+		friend T &operator*=(T &x, const double_double &d)
+		{
+			return x = static_cast<T>(x * d);
+		}
+		/// Generic binary multiplication involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::double_double and \p U is an \ref interop "interoperable type" or piranha::real,
+		 * - \p U is piranha::double_double and \p T is an \ref interop "interoperable type" or piranha::real,
+		 * - both \p T and \p U are piranha::double_double.
+		 *
+		 * The return type is piranha::real if one of the arguments is piranha::real, piranha::double_double otherwise.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x * y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator*(const T &x, const U &y) -> decltype(double_double::binary_mul(x,y))
+		{
+			return binary_mul(x,y);
+		}
+		/// In-place division.
+		/**
+		 * Division by zero follows the IEEE 754 semantics of the high parts.
+		 *
+		 * @param[in] other argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &operator/=(const double_double &other) noexcept
+		{
+			dd_div(other);
+			return *this;
+		}
+		/// Generic in-place division.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is an \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the corresponding binary operator or by
+		 * the constructor from \p T.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		double_double &operator/=(const T &x)
+		{
+			return (*this = static_cast<double_double>(*this / x));
+		}
+		/// Generic in-place division with piranha::double_double.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is a non-const \ref interop "interoperable type" or piranha::real.
+		 *
+		 * @param[in,out] x first argument.
+		 * @param[in] d second argument.
+		 *
+		 * @return reference to \p x.
+		 *
+		 * @throws unspecified any exception resulting from the binary operator or by casting piranha::double_double to \p T.
+		 */
+		template <typename T, generic_in_place_enabler<T> = 0>
+		friend T &operator/=(T &x, const double_double &d)
+		{
+			return x = static_cast<T>(x / d);
+		}
+		/// Generic binary division involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::double_double and \p U is an \ref interop "interoperable type" or piranha::real,
+		 * - \p U is piranha::double_double and \p T is an \ref interop "interoperable type" or piranha::real,
+		 * - both \p T and \p U are piranha::double_double.
+		 *
+		 * The return type is piranha::real if one of the arguments is piranha::real, piranha::double_double otherwise.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x / y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator/(const T &x, const U &y) -> decltype(double_double::binary_div(x,y))
+		{
+			return binary_div(x,y);
+		}
+		/// Combined multiply-add.
+		/**
+		 * Sets \p this to <tt>this + (r1 * r2)</tt>.
+		 *
+		 * @param[in] r1 first argument.
+		 * @param[in] r2 second argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		double_double &multiply_accumulate(const double_double &r1, const double_double &r2) noexcept
+		{
+			double p1, p2;
+			two_prod(p1,p2,r1.m_hi,r2.m_hi);
+			if (unlikely(!std::isfinite(p1))) {
+				m_hi += p1;
+				m_lo = 0.;
+				return *this;
+			}
+			p2 += r1.m_hi * r2.m_lo + r1.m_lo * r2.m_hi;
+			// NOTE: the product is added before normalisation, the error is
+			// still within the bounds of separate multiplication and addition.
+			double s1, s2, t1, t2;
+			two_sum(s1,s2,m_hi,p1);
+			if (handle_non_finite(s1)) {
+				return *this;
+			}
+			two_sum(t1,t2,m_lo,p2);
+			s2 += t1;
+			quick_two_sum(s1,s2,s1,s2);
+			s2 += t2;
+			normalise(s1,s2);
+			return *this;
+		}
+		/// Generic equality operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::double_double and \p U is an \ref interop "interoperable type" or piranha::real,
+		 * - \p U is piranha::double_double and \p T is an \ref interop "interoperable type" or piranha::real,
+		 * - both \p T and \p U are piranha::double_double.
+		 *
+		 * Interoperable types are converted to piranha::double_double before the comparison, piranha::double_double
+		 * is converted to piranha::real when comparing to piranha::real.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x == y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator==(const T &x, const U &y) -> decltype(double_double::binary_equality(x,y))
+		{
+			return binary_equality(x,y);
+		}
+		/// Generic inequality operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::double_double::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x != y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by piranha::double_double::operator==().
+		 */
+		template <typename T, typename U>
+		friend auto operator!=(const T &x, const U &y) -> decltype(!double_double::binary_equality(x,y))
+		{
+			return !binary_equality(x,y);
+		}
+		/// Generic less-than operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::double_double::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x < y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator<(const T &x, const U &y) -> decltype(double_double::binary_less_than(x,y))
+		{
+			return binary_less_than(x,y);
+		}
+		/// Generic less-than or equal operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::double_double::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x <= y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator<=(const T &x, const U &y) -> decltype(double_double::binary_leq(x,y))
+		{
+			return binary_leq(x,y);
+		}
+		/// Generic greater-than operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::double_double::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x > y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator>(const T &x, const U &y) -> decltype(double_double::binary_less_than(y,x))
+		{
+			return binary_less_than(y,x);
+		}
+		/// Generic greater-than or equal operator involving piranha::double_double.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::double_double::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x >= y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the conversion of the arguments to piranha::double_double
+		 * or piranha::real.
+		 */
+		template <typename T, typename U>
+		friend auto operator>=(const T &x, const U &y) -> decltype(double_double::binary_leq(y,x))
+		{
+			return binary_leq(y,x);
+		}
+		/// Integral exponentiation.
+		/**
+		 * \note
+		 * This method is enabled only if \p T is a C++ integral type or piranha::mp_integer.
+		 *
+		 * The result is computed via exponentiation by squaring.
+		 *
+		 * @param[in] n exponent.
+		 *
+		 * @return <tt>this ** n</tt>.
+		 *
+		 * @throws std::overflow_error if the absolute value of \p n is larger than an implementation-defined value.
+		 */
+		template <typename T, typename std::enable_if<std::is_integral<T>::value || detail::is_mp_integer<T>::value,int>::type = 0>
+		double_double pow(const T &n) const
+		{
+			return pow_integral(*this,n);
+		}
+		/// Sine.
+		/**
+		 * @return sine of \p this.
+		 *
+		 * @throws unspecified any exception thrown by piranha::real::sin(), which is used for arguments of large magnitude.
+		 */
+		double_double sin() const
+		{
+			double_double s, c;
+			sin_cos(s,c);
+			return s;
+		}
+		/// Cosine.
+		/**
+		 * @return cosine of \p this.
+		 *
+		 * @throws unspecified any exception thrown by piranha::real::cos(), which is used for arguments of large magnitude.
+		 */
+		double_double cos() const
+		{
+			double_double s, c;
+			sin_cos(s,c);
+			return c;
+		}
+		/// Overload output stream operator for piranha::double_double.
+		/**
+		 * The value is printed via piranha::real, using the shortest decimal representation that identifies
+		 * uniquely the piranha::real with default precision that \p d converts to.
+		 *
+		 * @param[in] os output stream.
+		 * @param[in] d piranha::double_double to be directed to stream.
+		 *
+		 * @return reference to \p os.
+		 *
+		 * @throws unspecified any exception thrown by the stream operator of piranha::real.
+		 */
+		friend std::ostream &operator<<(std::ostream &os, const double_double &d)
+		{
+			return os << static_cast<real>(d);
+		}
+		/// Overload input stream operator for piranha::double_double.
+		/**
+		 * Equivalent to extracting a line from the stream and then constructing \p d from it.
+		 *
+		 * @param[in] is input stream.
+		 * @param[in,out] d double_double to which the contents of the stream will be assigned.
+		 *
+		 * @return reference to \p is.
+		 *
+		 * @throws unspecified any exception thrown by the constructor from string of piranha::double_double.
+		 */
+		friend std::istream &operator>>(std::istream &is, double_double &d)
+		{
+			std::string tmp_str;
+			std::getline(is,tmp_str);
+			d = double_double(tmp_str);
+			return is;
+		}
+	private:
+		double	m_hi;
+		double	m_lo;
+};
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::negate() functor for piranha::double_double.
+template <typename T>
+struct negate_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in,out] x piranha::double_double to be negated.
+	 */
+	void operator()(double_double &x) const noexcept
+	{
+		x.negate();
+	}
+};
+
+/// Specialisation of the piranha::math::is_zero() functor for piranha::double_double.
+template <typename T>
+struct is_zero_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x piranha::double_double to be tested.
+	 *
+	 * @return \p true if \p x is zero, \p false otherwise.
+	 */
+	bool operator()(const T &x) const noexcept
+	{
+		return x.is_zero();
+	}
+};
+
+}
+
+namespace detail
+{
+
+// Enabler for double_double pow.
+template <typename T, typename U>
+using double_double_pow_enabler = typename std::enable_if<
+	(std::is_same<double_double,T>::value && (is_double_double_interoperable_type<U>::value || std::is_same<real,U>::value)) ||
+	(std::is_same<double_double,U>::value && (is_double_double_interoperable_type<T>::value || std::is_same<real,T>::value)) ||
+	(std::is_same<double_double,T>::value && std::is_same<double_double,U>::value)
+>::type;
+
+}
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::pow() functor for piranha::double_double.
+/**
+ * This specialisation is activated when one of the arguments is piranha::double_double
+ * and the other is either piranha::double_double, piranha::real or an interoperable type for piranha::double_double.
+ *
+ * The implementation follows these rules:
+ * - if the base is piranha::double_double and the exponent is a C++ integral type or piranha::mp_integer,
+ *   then piranha::double_double::pow() is used;
+ * - if one of the arguments is piranha::real, the other one is converted to piranha::real and piranha::real::pow()
+ *   is used;
+ * - otherwise, both arguments are converted to piranha::real, piranha::real::pow() is used and the result is converted back
+ *   to piranha::double_double.
+ */
+template <typename T, typename U>
+struct pow_impl<T,U,detail::double_double_pow_enabler<T,U>>
+{
+	/// Call operator, integral exponent overload.
+	/**
+	 * @param[in] x base.
+	 * @param[in] n exponent.
+	 *
+	 * @return \p x to the power of \p n.
+	 *
+	 * @throws unspecified any exception thrown by piranha::double_double::pow().
+	 */
+	template <typename T2, typename std::enable_if<std::is_integral<T2>::value || detail::is_mp_integer<T2>::value,int>::type = 0>
+	double_double operator()(const double_double &x, const T2 &n) const
+	{
+		return x.pow(n);
+	}
+	/// Call operator, piranha::real overload.
+	/**
+	 * \note
+	 * This operator is enabled if either argument is piranha::real.
+	 *
+	 * @param[in] x base.
+	 * @param[in] y exponent.
+	 *
+	 * @return \p x to the power of \p y.
+	 *
+	 * @throws unspecified any exception thrown by piranha::real::pow() or by the conversion to piranha::real.
+	 */
+	template <typename T2, typename U2, typename std::enable_if<std::is_same<T2,real>::value || std::is_same<U2,real>::value,int>::type = 0>
+	real operator()(const T2 &x, const U2 &y) const
+	{
+		return static_cast<real>(x).pow(static_cast<real>(y));
+	}
+	/// Call operator, generic overload.
+	/**
+	 * \note
+	 * This operator is enabled if none of the other overloads is.
+	 *
+	 * @param[in] x base.
+	 * @param[in] y exponent.
+	 *
+	 * @return \p x to the power of \p y.
+	 *
+	 * @throws unspecified any exception thrown by piranha::real::pow() or by the conversions to and from piranha::real.
+	 */
+	template <typename T2, typename U2, typename std::enable_if<!std::is_same<T2,real>::value && !std::is_same<U2,real>::value &&
+		!(std::is_same<T2,double_double>::value && (std::is_integral<U2>::value || detail::is_mp_integer<U2>::value)),int>::type = 0>
+	double_double operator()(const T2 &x, const U2 &y) const
+	{
+		return double_double(static_cast<real>(x).pow(static_cast<real>(y)));
+	}
+};
+
+/// Specialisation of the piranha::math::sin() functor for piranha::double_double.
+template <typename T>
+struct sin_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * The operation will return the output of piranha::double_double::sin().
+	 *
+	 * @param[in] x argument.
+	 *
+	 * @return sine of \p x.
+	 *
+	 * @throws unspecified any exception thrown by piranha::double_double::sin().
+	 */
+	double_double operator()(const T &x) const
+	{
+		return x.sin();
+	}
+};
+
+/// Specialisation of the piranha::math::cos() functor for piranha::double_double.
+template <typename T>
+struct cos_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * The operation will return the output of piranha::double_double::cos().
+	 *
+	 * @param[in] x argument.
+	 *
+	 * @return cosine of \p x.
+	 *
+	 * @throws unspecified any exception thrown by piranha::double_double::cos().
+	 */
+	double_double operator()(const T &x) const
+	{
+		return x.cos();
+	}
+};
+
+/// Specialisation of the piranha::math::abs() functor for piranha::double_double.
+template <typename T>
+struct abs_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x input parameter.
+	 *
+	 * @return absolute value of \p x.
+	 */
+	T operator()(const T &x) const noexcept
+	{
+		return x.abs();
+	}
+};
+
+/// Specialisation of the piranha::math::partial() functor for piranha::double_double.
+template <typename T>
+struct partial_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @return an instance of piranha::double_double constructed from zero.
+	 */
+	double_double operator()(const double_double &, const std::string &) const noexcept
+	{
+		return double_double{};
+	}
+};
+
+/// Specialisation of the piranha::math::evaluate() functor for piranha::double_double.
+template <typename T>
+struct evaluate_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x evaluation argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::unordered_map<std::string,U> &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the piranha::math::subs() functor for piranha::double_double.
+template <typename T>
+struct subs_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x substitution argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::string &, const U &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the piranha::math::integral_cast functor for piranha::double_double.
+template <typename T>
+struct integral_cast_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * The call will be successful if \p x is finite and if it does not change after truncation.
+	 *
+	 * @param[in] x cast argument.
+	 *
+	 * @return result of the cast operation.
+	 *
+	 * @throws std::invalid_argument if the conversion is not successful.
+	 */
+	integer operator()(const T &x) const
+	{
+		if (x.is_nan() || x.is_inf()) {
+			piranha_throw(std::invalid_argument,"invalid double_double value");
+		}
+		// NOTE: a double-double is integral iff both its components are.
+		if (std::trunc(x.hi()) == x.hi() && std::trunc(x.lo()) == x.lo()) {
+			return static_cast<integer>(x);
+		}
+		piranha_throw(std::invalid_argument,"invalid double_double value");
+	}
+};
+
+/// Specialisation of the piranha::math::ipow_subs() functor for piranha::double_double.
+/**
+ * This specialisation is activated when \p T is piranha::double_double.
+ * The result will be the input value unchanged.
+ */
+template <typename T>
+struct ipow_subs_impl<T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x substitution argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::string &, const integer &, const U &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the implementation of piranha::math::multiply_accumulate() for piranha::double_double.
+template <typename T>
+struct multiply_accumulate_impl<T,T,T,typename std::enable_if<std::is_same<T,double_double>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * This implementation will use piranha::double_double::multiply_accumulate().
+	 *
+	 * @param[in,out] x target value for accumulation.
+	 * @param[in] y first argument.
+	 * @param[in] z second argument.
+	 *
+	 * @return <tt>x.multiply_accumulate(y,z)</tt>.
+	 */
+	auto operator()(T &x, const T &y, const T &z) const noexcept -> decltype(x.multiply_accumulate(y,z))
+	{
+		return x.multiply_accumulate(y,z);
+	}
+};
+
+}
+
+// NOTE: the static checks live here rather than in the destructor (as done elsewhere), as we want
+// double_double to be trivially copyable and destructible.
+PIRANHA_TT_CHECK(is_cf,double_double);
+static_assert(std::numeric_limits<double>::is_iec559 && std::numeric_limits<double>::digits == 53,
+	"double_double requires IEEE 754 double-precision.");
+
+}
+
+#endif
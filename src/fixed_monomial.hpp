@@ -0,0 +1,832 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_FIXED_MONOMIAL_HPP
+#define PIRANHA_FIXED_MONOMIAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <boost/functional/hash.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "config.hpp"
+#include "detail/prepare_for_print.hpp"
+#include "detail/symbol_set_remap.hpp"
+#include "detail/vector_kernels.hpp"
+#include "exceptions.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "mp_rational.hpp"
+#include "symbol_set.hpp"
+#include "symbol.hpp"
+#include "type_traits.hpp"
+
+namespace piranha
+{
+
+/// Fixed-arity monomial class.
+/**
+ * This class represents a multivariate monomial with integral exponents, in at most \p N variables. The exponents are stored
+ * in an \p std::array of size \p N: the first exponents correspond to the symbols of the reference piranha::symbol_set,
+ * the remaining ones are always zero. Since the size of the storage is known at compile time,
+ * the arithmetic, hashing and comparison operations run over a fixed number of elements and they can be fully unrolled
+ * by the compiler, without the size bookkeeping of piranha::monomial.
+ *
+ * A monomial is compatible with a piranha::symbol_set only if the size of the set does not exceed \p N. Hence, series
+ * using this class as key type cannot have more than \p N arguments.
+ *
+ * This class satisfies the piranha::is_key, piranha::key_has_degree and piranha::key_has_ldegree type traits.
+ *
+ * \section type_requirements Type requirements
+ *
+ * - \p T must be a C++ integral type different from \p bool;
+ * - \p N must be strictly positive.
+ *
+ * \section exception_safety Exception safety guarantee
+ *
+ * Unless otherwise specified, this class provides the strong exception safety guarantee for all operations.
+ *
+ * \section move_semantics Move semantics
+ *
+ * The move semantics of this class are equivalent to the move semantics of \p std::array.
+ *
+ * @author Francesco Biscani (bluescarni@gmail.com)
+ */
+template <typename T, std::size_t N>
+class fixed_monomial
+{
+		static_assert(detail::vk_enabled<T>::value,"The exponent type must be an integral type different from bool.");
+		static_assert(N > 0u,"The number of exponents must be strictly positive.");
+	public:
+		/// Alias for \p T.
+		typedef T value_type;
+		/// Size type.
+		typedef std::size_t size_type;
+		/// Maximum monomial size.
+		static const size_type max_size = N;
+	private:
+		typedef std::array<value_type,N> container_type;
+		// Eval and sub typedef.
+		template <typename U, typename = void>
+		struct eval_type {};
+		template <typename U>
+		using e_type = decltype(math::pow(std::declval<U const &>(),std::declval<value_type const &>()));
+		template <typename U>
+		struct eval_type<U,typename std::enable_if<is_multipliable_in_place<e_type<U>>::value &&
+			std::is_constructible<e_type<U>,int>::value>::type>
+		{
+			using type = e_type<U>;
+		};
+		// Check that the arguments set can be used with the monomial.
+		void check_args(const symbol_set &args) const
+		{
+			if (unlikely(!is_compatible(args))) {
+				piranha_throw(std::invalid_argument,"invalid arguments set");
+			}
+		}
+		// Add a value to an exponent, checking for overflow.
+		static value_type checked_add(const value_type &a, const integer &b)
+		{
+			return static_cast<value_type>(integer(a) + b);
+		}
+	public:
+		/// Default constructor.
+		/**
+		 * After construction all exponents in the monomial will be zero.
+		 */
+		fixed_monomial():m_value() {}
+		/// Defaulted copy constructor.
+		fixed_monomial(const fixed_monomial &) = default;
+		/// Defaulted move constructor.
+		fixed_monomial(fixed_monomial &&) = default;
+		/// Constructor from initializer list.
+		/**
+		 * The values in the initializer list are intended to represent the exponents of the monomial:
+		 * they will be converted to type \p T via \p boost::numeric_cast.
+		 *
+		 * @param[in] list initializer list representing the exponents.
+		 *
+		 * @throws std::invalid_argument if the size of \p list is greater than \p N.
+		 * @throws unspecified any exception thrown by \p boost::numeric_cast.
+		 */
+		template <typename U>
+		explicit fixed_monomial(std::initializer_list<U> list):m_value()
+		{
+			if (unlikely(list.size() > N)) {
+				piranha_throw(std::invalid_argument,"excessive number of exponents for fixed monomial");
+			}
+			std::transform(list.begin(),list.end(),m_value.begin(),[](const U &x) {return boost::numeric_cast<value_type>(x);});
+		}
+		/// Constructor from range.
+		/**
+		 * \note
+		 * This constructor is enabled only if \p Iterator is an input iterator.
+		 *
+		 * The exponents of the monomial will be set to the values in the range, converted to \p T via \p boost::numeric_cast.
+		 *
+		 * @param[in] start beginning of the range.
+		 * @param[in] end end of the range.
+		 *
+		 * @throws std::invalid_argument if the size of the range is greater than \p N.
+		 * @throws unspecified any exception thrown by \p boost::numeric_cast.
+		 */
+		template <typename Iterator, typename = typename std::enable_if<is_input_iterator<Iterator>::value>::type>
+		explicit fixed_monomial(const Iterator &start, const Iterator &end):m_value()
+		{
+			size_type i = 0u;
+			for (Iterator it = start; it != end; ++it, ++i) {
+				if (unlikely(i == N)) {
+					piranha_throw(std::invalid_argument,"excessive number of exponents for fixed monomial");
+				}
+				m_value[i] = boost::numeric_cast<value_type>(*it);
+			}
+		}
+		/// Constructor from set of symbols.
+		/**
+		 * After construction all exponents in the monomial will be zero.
+		 *
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @throws std::invalid_argument if the size of \p args is greater than \p N.
+		 */
+		explicit fixed_monomial(const symbol_set &args):m_value()
+		{
+			if (unlikely(args.size() > N)) {
+				piranha_throw(std::invalid_argument,"excessive number of symbols for fixed monomial");
+			}
+		}
+		/// Converting constructor.
+		/**
+		 * This constructor is for use when converting from one term type to another in piranha::series. It will
+		 * copy the exponents of \p other, after having checked that \p other is compatible with \p args.
+		 *
+		 * @param[in] other construction argument.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @throws std::invalid_argument if \p other is not compatible with \p args.
+		 */
+		explicit fixed_monomial(const fixed_monomial &other, const symbol_set &args):m_value(other.m_value)
+		{
+			other.check_args(args);
+		}
+		/// Trivial destructor.
+		~fixed_monomial()
+		{
+			PIRANHA_TT_CHECK(is_key,fixed_monomial);
+			PIRANHA_TT_CHECK(key_has_degree,fixed_monomial);
+			PIRANHA_TT_CHECK(key_has_ldegree,fixed_monomial);
+		}
+		/// Defaulted copy assignment operator.
+		fixed_monomial &operator=(const fixed_monomial &) = default;
+		/// Defaulted move assignment operator.
+		fixed_monomial &operator=(fixed_monomial &&) = default;
+		/// Exponent access.
+		/**
+		 * @param[in] i index of the exponent.
+		 *
+		 * @return const reference to the <tt>i</tt>-th exponent.
+		 */
+		const value_type &operator[](const size_type &i) const
+		{
+			piranha_assert(i < N);
+			return m_value[i];
+		}
+		/// Compatibility check.
+		/**
+		 * The monomial is compatible with \p args if the size of \p args is not greater than \p N, and if all the exponents
+		 * past the size of \p args are zero.
+		 *
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return compatibility flag for the monomial.
+		 */
+		bool is_compatible(const symbol_set &args) const noexcept
+		{
+			const auto size = args.size();
+			if (size > N) {
+				return false;
+			}
+			return std::all_of(m_value.begin() + size,m_value.end(),[](const value_type &x) {return x == value_type(0);});
+		}
+		/// Ignorability check.
+		/**
+		 * A monomial is never considered ignorable.
+		 *
+		 * @return \p false.
+		 */
+		bool is_ignorable(const symbol_set &) const noexcept
+		{
+			return false;
+		}
+		/// Merge arguments.
+		/**
+		 * Merge the new arguments set \p new_args into \p this, given the current reference arguments set
+		 * \p orig_args.
+		 *
+		 * @param[in] orig_args original arguments set.
+		 * @param[in] new_args new arguments set.
+		 *
+		 * @return monomial with merged arguments.
+		 *
+		 * @throws std::invalid_argument if at least one of these conditions is true:
+		 * - the size of \p new_args is not greater than the size of \p orig_args,
+		 * - not all elements of \p orig_args are included in \p new_args,
+		 * - the size of \p new_args is greater than \p N,
+		 * - \p this is not compatible with \p orig_args.
+		 * @throws unspecified any exception thrown by memory allocation errors in standard containers.
+		 */
+		fixed_monomial merge_args(const symbol_set &orig_args, const symbol_set &new_args) const
+		{
+			check_args(orig_args);
+			const auto &map = detail::ss_merge_remap(orig_args,new_args);
+			if (unlikely(new_args.size() > N)) {
+				piranha_throw(std::invalid_argument,"excessive number of symbols for fixed monomial");
+			}
+			fixed_monomial retval;
+			for (size_type i = 0u; i < map.size(); ++i) {
+				if (map[i] != orig_args.size()) {
+					retval.m_value[i] = m_value[static_cast<size_type>(map[i])];
+				}
+			}
+			return retval;
+		}
+		/// Check if monomial is unitary.
+		/**
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return \p true if all the exponents are zero, \p false otherwise.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 */
+		bool is_unitary(const symbol_set &args) const
+		{
+			check_args(args);
+			return *this == fixed_monomial{};
+		}
+		/// Degree.
+		/**
+		 * The summation is computed over all the \p N exponents (the ones past the size of \p args being zero),
+		 * with modular arithmetic.
+		 *
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return degree of the monomial.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 */
+		value_type degree(const symbol_set &args) const
+		{
+			check_args(args);
+			return detail::vector_sum(m_value.data(),N);
+		}
+		/// Low degree.
+		/**
+		 * Equivalent to the degree.
+		 *
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return low degree of the monomial.
+		 *
+		 * @throws unspecified any exception thrown by degree().
+		 */
+		value_type ldegree(const symbol_set &args) const
+		{
+			return degree(args);
+		}
+		/// Partial degree.
+		/**
+		 * Partial degree of the monomial: only the symbols with names in \p active_args are considered during the computation
+		 * of the degree. Symbols in \p active_args not appearing in \p args are not considered.
+		 *
+		 * @param[in] active_args names of the symbols that will be considered in the computation of the partial degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return the summation of all the exponents of the monomial corresponding to the symbols in
+		 * \p active_args, or <tt>value_type(0)</tt> if no symbols in \p active_args appear in \p args.
+		 *
+		 * @throws unspecified any exception thrown by the degree from positions, or by the construction
+		 * of piranha::symbol_set::positions.
+		 */
+		value_type degree(const std::set<std::string> &active_args, const symbol_set &args) const
+		{
+			return degree(symbol_set::positions(args,active_args),args);
+		}
+		/// Partial low degree.
+		/**
+		 * Equivalent to the partial degree.
+		 *
+		 * @param[in] active_args names of the symbols that will be considered in the computation of the partial low degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return partial low degree of the monomial.
+		 *
+		 * @throws unspecified any exception thrown by degree().
+		 */
+		value_type ldegree(const std::set<std::string> &active_args, const symbol_set &args) const
+		{
+			return degree(active_args,args);
+		}
+		/// Partial degree from positions.
+		/**
+		 * Equivalent to the partial degree, but the symbols to be considered are identified by their positions
+		 * in \p args.
+		 *
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return the summation of all the exponents of the monomial corresponding to the positions in \p p.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args, or if the positions in \p p
+		 * are not compatible with \p args.
+		 */
+		value_type degree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			check_args(args);
+			if (unlikely(p.size() && p.back() >= args.size())) {
+				piranha_throw(std::invalid_argument,"invalid positions");
+			}
+			value_type retval(0);
+			for (const auto &i: p) {
+				retval = static_cast<value_type>(retval + m_value[static_cast<size_type>(i)]);
+			}
+			return retval;
+		}
+		/// Partial low degree from positions.
+		/**
+		 * Equivalent to the partial degree from positions.
+		 *
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial low degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return partial low degree of the monomial.
+		 *
+		 * @throws unspecified any exception thrown by degree().
+		 */
+		value_type ldegree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			return degree(p,args);
+		}
+		/// Multiply monomials.
+		/**
+		 * Multiplies \p this by \p other and stores the result in \p retval. The exponents are added with overflow
+		 * detection over the whole storage, without branching on the size of \p args.
+		 * In case of exceptions, \p retval will be left in a valid but unspecified state.
+		 *
+		 * @param[out] retval return value.
+		 * @param[in] other argument of multiplication.
+		 * @param[in] args reference set of arguments.
+		 *
+		 * @throws std::invalid_argument if the size of \p args is greater than \p N.
+		 * @throws std::overflow_error if the addition of two exponents overflows.
+		 */
+		void multiply(fixed_monomial &retval, const fixed_monomial &other, const symbol_set &args) const
+		{
+			if (unlikely(args.size() > N)) {
+				piranha_throw(std::invalid_argument,"invalid size of arguments set");
+			}
+			if (unlikely(!detail::vector_add_checked(retval.m_value.data(),m_value.data(),other.m_value.data(),N))) {
+				piranha_throw(std::overflow_error,"overflow in the multiplication of two monomials");
+			}
+		}
+		/// Hash value.
+		/**
+		 * @return a hash value computed by mixing via \p boost::hash_combine the hash values of all the \p N exponents.
+		 */
+		std::size_t hash() const
+		{
+			std::hash<value_type> hasher;
+			std::size_t retval = hasher(m_value[0u]);
+			for (size_type i = 1u; i < N; ++i) {
+				boost::hash_combine(retval,hasher(m_value[i]));
+			}
+			return retval;
+		}
+		/// Equality operator.
+		/**
+		 * @param[in] other comparison argument.
+		 *
+		 * @return \p true if all the exponents of \p this and \p other are equal, \p false otherwise.
+		 */
+		bool operator==(const fixed_monomial &other) const
+		{
+			return detail::vector_equal(m_value.data(),other.m_value.data(),N);
+		}
+		/// Inequality operator.
+		/**
+		 * @param[in] other comparison argument.
+		 *
+		 * @return the opposite of operator==().
+		 */
+		bool operator!=(const fixed_monomial &other) const
+		{
+			return !(*this == other);
+		}
+		/// Name of the linear argument.
+		/**
+		 * If the monomial is linear in a variable (i.e., all exponents are zero apart from a single unitary
+		 * exponent), the name of the variable will be returned. Otherwise, an error will be raised.
+		 *
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return name of the linear variable.
+		 *
+		 * @throws std::invalid_argument if the monomial is not linear or if \p this is not compatible with \p args.
+		 */
+		std::string linear_argument(const symbol_set &args) const
+		{
+			check_args(args);
+			size_type n_linear = 0u, candidate = 0u;
+			for (size_type i = 0u; i < args.size(); ++i) {
+				if (m_value[i] == value_type(0)) {
+					continue;
+				}
+				if (m_value[i] != value_type(1)) {
+					piranha_throw(std::invalid_argument,"exponent is not unitary");
+				}
+				candidate = i;
+				++n_linear;
+			}
+			if (n_linear != 1u) {
+				piranha_throw(std::invalid_argument,"monomial is not linear");
+			}
+			return args[candidate].get_name();
+		}
+		/// Exponentiation.
+		/**
+		 * \note
+		 * This method is enabled only if \p U can be used in piranha::math::integral_cast().
+		 *
+		 * Will return a monomial corresponding to \p this raised to the <tt>x</tt>-th power. The exponentiation
+		 * is computed via multiplication of the exponents by the output of piranha::math::integral_cast()
+		 * on \p x.
+		 *
+		 * @param[in] x exponent.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return \p this to the power of \p x.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by:
+		 * - piranha::math::integral_cast(),
+		 * - the cast and binary multiplication operators of piranha::integer.
+		 */
+		template <typename U, typename = typename std::enable_if<has_integral_cast<U>::value>::type>
+		fixed_monomial pow(const U &x, const symbol_set &args) const
+		{
+			check_args(args);
+			const integer n = math::integral_cast(x);
+			fixed_monomial retval;
+			for (size_type i = 0u; i < args.size(); ++i) {
+				retval.m_value[i] = static_cast<value_type>(n * m_value[i]);
+			}
+			return retval;
+		}
+		/// Print.
+		/**
+		 * Will print to stream a human-readable representation of the monomial.
+		 *
+		 * @param[in] os target stream.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by streaming instances of \p value_type.
+		 */
+		void print(std::ostream &os, const symbol_set &args) const
+		{
+			check_args(args);
+			const value_type zero(0), one(1);
+			bool empty_output = true;
+			for (size_type i = 0u; i < args.size(); ++i) {
+				if (m_value[i] != zero) {
+					if (!empty_output) {
+						os << '*';
+					}
+					os << args[i].get_name();
+					empty_output = false;
+					if (m_value[i] != one) {
+						os << "**" << detail::prepare_for_print(m_value[i]);
+					}
+				}
+			}
+		}
+		/// Print in TeX mode.
+		/**
+		 * Will print to stream a TeX representation of the monomial.
+		 *
+		 * @param[in] os target stream.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by streaming instances of \p value_type or piranha::integer.
+		 */
+		void print_tex(std::ostream &os, const symbol_set &args) const
+		{
+			check_args(args);
+			std::ostringstream oss_num, oss_den, *cur_oss;
+			const value_type zero(0);
+			for (size_type i = 0u; i < args.size(); ++i) {
+				if (m_value[i] != zero) {
+					// NOTE: go through integer in order to be able to negate the minimum value of the exponent type.
+					integer cur_value(m_value[i]);
+					cur_oss = (m_value[i] > zero) ? std::addressof(oss_num) : (math::negate(cur_value),std::addressof(oss_den));
+					(*cur_oss) << "{" << args[i].get_name() << "}";
+					if (cur_value != 1) {
+						(*cur_oss) << "^{" << cur_value << "}";
+					}
+				}
+			}
+			const std::string num_str = oss_num.str(), den_str = oss_den.str();
+			if (!num_str.empty() && !den_str.empty()) {
+				os << "\\frac{" << num_str << "}{" << den_str << "}";
+			} else if (!num_str.empty() && den_str.empty()) {
+				os << num_str;
+			} else if (num_str.empty() && !den_str.empty()) {
+				os << "\\frac{1}{" << den_str << "}";
+			}
+		}
+		/// Partial derivative.
+		/**
+		 * Will return the partial derivative of \p this with respect to symbol \p s. The result is a pair
+		 * consisting of the exponent associated to \p s before differentiation and the monomial itself
+		 * after differentiation. If \p s is not in \p args or if the exponent associated to it is zero,
+		 * the returned pair will be <tt>(0,fixed_monomial{})</tt>.
+		 *
+		 * @param[in] s symbol with respect to which the differentiation will be calculated.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return result of the differentiation.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by the cast operator of piranha::integer.
+		 */
+		std::pair<integer,fixed_monomial> partial(const symbol &s, const symbol_set &args) const
+		{
+			check_args(args);
+			for (size_type i = 0u; i < args.size(); ++i) {
+				if (args[i] == s && m_value[i] != value_type(0)) {
+					fixed_monomial tmp_m(*this);
+					tmp_m.m_value[i] = checked_add(m_value[i],integer(-1));
+					return std::make_pair(integer(m_value[i]),std::move(tmp_m));
+				}
+			}
+			return std::make_pair(integer(0),fixed_monomial{});
+		}
+		/// Integration.
+		/**
+		 * Will return the antiderivative of \p this with respect to symbol \p s. The result is a pair
+		 * consisting of the exponent associated to \p s and the monomial itself
+		 * after integration. If \p s is not in \p args, the returned monomial will have an extra exponent
+		 * set to 1 in the same position \p s would have if it were added to \p args.
+		 *
+		 * If the exponent corresponding to \p s is -1, an error will be produced.
+		 *
+		 * @param[in] s symbol with respect to which the integration will be calculated.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return result of the integration.
+		 *
+		 * @throws std::invalid_argument if the exponent associated to \p s is -1, if \p this is not compatible
+		 * with \p args, or if \p s is not in \p args and the size of \p args is already \p N.
+		 * @throws unspecified any exception thrown by the cast operator of piranha::integer.
+		 */
+		std::pair<integer,fixed_monomial> integrate(const symbol &s, const symbol_set &args) const
+		{
+			check_args(args);
+			const auto it = std::lower_bound(args.begin(),args.end(),s);
+			const auto pos = static_cast<size_type>(it - args.begin());
+			fixed_monomial retval(*this);
+			if (it != args.end() && *it == s) {
+				retval.m_value[pos] = checked_add(m_value[pos],integer(1));
+				if (retval.m_value[pos] == value_type(0)) {
+					piranha_throw(std::invalid_argument,"unable to perform monomial integration: negative unitary exponent");
+				}
+				return std::make_pair(integer(retval.m_value[pos]),std::move(retval));
+			}
+			if (unlikely(args.size() == N)) {
+				piranha_throw(std::invalid_argument,"excessive number of symbols for fixed monomial");
+			}
+			// Make room for the new exponent.
+			std::copy_backward(m_value.begin() + pos,m_value.begin() + args.size(),retval.m_value.begin() + args.size() + 1u);
+			retval.m_value[pos] = value_type(1);
+			return std::make_pair(integer(1),std::move(retval));
+		}
+		/// Evaluation.
+		/**
+		 * \note
+		 * This method is available only if \p U satisfies the following requirements:
+		 * - it can be used in piranha::math::pow() with the monomial exponents as powers,
+		 * - it is constructible from \p int,
+		 * - it is multipliable in place.
+		 *
+		 * The return value will be built by iteratively applying piranha::math::pow() using the values provided
+		 * by \p dict as bases and the values in the monomial as exponents. If a symbol in \p args is not found
+		 * in \p dict, an error will be raised. If the size of \p args is zero, 1 will be returned.
+		 *
+		 * @param[in] dict dictionary that will be used for substitution.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return the result of evaluating \p this with the values provided in \p dict.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args, or if a symbol in \p args is not found in \p dict.
+		 * @throws unspecified any exception thrown by:
+		 * - construction of the return type,
+		 * - lookup operations in \p std::unordered_map,
+		 * - piranha::math::pow() or the in-place multiplication operator of the return type.
+		 */
+		template <typename U>
+		typename eval_type<U>::type evaluate(const std::unordered_map<symbol,U> &dict, const symbol_set &args) const
+		{
+			typedef typename eval_type<U>::type return_type;
+			check_args(args);
+			return_type retval(1);
+			const auto it_f = dict.end();
+			for (size_type i = 0u; i < args.size(); ++i) {
+				const auto it = dict.find(args[i]);
+				if (it == it_f) {
+					piranha_throw(std::invalid_argument,
+						std::string("cannot evaluate monomial: symbol \'") + args[i].get_name() +
+						"\' does not appear in dictionary");
+				}
+				retval *= math::pow(it->second,m_value[i]);
+			}
+			return retval;
+		}
+		/// Substitution.
+		/**
+		 * The algorithm is equivalent to the one implemented in piranha::monomial::subs().
+		 *
+		 * @param[in] s symbol that will be substituted.
+		 * @param[in] x quantity that will be substituted in place of \p s.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return the result of substituting \p x for \p s.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by:
+		 * - construction and assignment of the return value,
+		 * - piranha::math::pow().
+		 */
+		template <typename U>
+		std::pair<typename eval_type<U>::type,fixed_monomial> subs(const symbol &s, const U &x, const symbol_set &args) const
+		{
+			typedef typename eval_type<U>::type s_type;
+			check_args(args);
+			s_type retval_s(1);
+			const auto it = std::lower_bound(args.begin(),args.end(),s);
+			if (it == args.end() || *it != s) {
+				return std::make_pair(std::move(retval_s),*this);
+			}
+			const auto pos = static_cast<size_type>(it - args.begin());
+			retval_s = math::pow(x,m_value[pos]);
+			// Remove the exponent, shifting down the following ones.
+			fixed_monomial retval_key;
+			std::copy(m_value.begin(),m_value.begin() + pos,retval_key.m_value.begin());
+			std::copy(m_value.begin() + pos + 1u,m_value.begin() + args.size(),retval_key.m_value.begin() + pos);
+			return std::make_pair(std::move(retval_s),std::move(retval_key));
+		}
+		/// Substitution of integral power.
+		/**
+		 * This method works in the same way as piranha::monomial::ipow_subs().
+		 *
+		 * @param[in] s symbol that will be substituted.
+		 * @param[in] n power of \p s that will be substituted.
+		 * @param[in] x quantity that will be substituted in place of \p s to the power of \p n.
+		 * @param[in] args reference set of piranha::symbol.
+		 *
+		 * @return the result of substituting \p x for \p s to the power of \p n.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by:
+		 * - construction and assignment of the return value,
+		 * - construction of piranha::rational,
+		 * - piranha::math::pow(),
+		 * - the cast operator of piranha::integer.
+		 */
+		template <typename U>
+		std::pair<typename eval_type<U>::type,fixed_monomial> ipow_subs(const symbol &s, const integer &n, const U &x, const symbol_set &args) const
+		{
+			typedef typename eval_type<U>::type s_type;
+			check_args(args);
+			s_type retval_s(1);
+			fixed_monomial retval_key(*this);
+			const auto it = std::lower_bound(args.begin(),args.end(),s);
+			if (it != args.end() && *it == s) {
+				const auto pos = static_cast<size_type>(it - args.begin());
+				const rational tmp(integer(m_value[pos]),n);
+				if (tmp >= 1) {
+					const auto tmp_t = static_cast<integer>(tmp);
+					retval_s = math::pow(x,tmp_t);
+					retval_key.m_value[pos] = checked_add(m_value[pos],-(tmp_t * n));
+				}
+			}
+			return std::make_pair(std::move(retval_s),std::move(retval_key));
+		}
+		/// Identify symbols that can be trimmed.
+		/**
+		 * This method is used in piranha::series::trim(). The input parameter \p candidates
+		 * contains a set of symbols that are candidates for elimination. The method will remove
+		 * from \p candidates those symbols whose exponent in \p this is not zero.
+		 *
+		 * @param[in] candidates set of candidates for elimination.
+		 * @param[in] args reference arguments set.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p args.
+		 * @throws unspecified any exception thrown by piranha::symbol_set::remove().
+		 */
+		void trim_identify(symbol_set &candidates, const symbol_set &args) const
+		{
+			check_args(args);
+			for (size_type i = 0u; i < args.size(); ++i) {
+				if (m_value[i] != value_type(0) && std::binary_search(candidates.begin(),candidates.end(),args[i])) {
+					candidates.remove(args[i]);
+				}
+			}
+		}
+		/// Trim.
+		/**
+		 * This method will return a copy of \p this with the exponents associated to the symbols
+		 * in \p trim_args removed.
+		 *
+		 * @param[in] trim_args arguments whose exponents will be removed.
+		 * @param[in] orig_args original arguments set.
+		 *
+		 * @return trimmed copy of \p this.
+		 *
+		 * @throws std::invalid_argument if \p this is not compatible with \p orig_args.
+		 * @throws unspecified any exception thrown by memory allocation errors in standard containers.
+		 */
+		fixed_monomial trim(const symbol_set &trim_args, const symbol_set &orig_args) const
+		{
+			check_args(orig_args);
+			const auto &map = detail::ss_trim_remap(trim_args,orig_args);
+			fixed_monomial retval;
+			for (size_type i = 0u; i < map.size(); ++i) {
+				retval.m_value[i] = m_value[static_cast<size_type>(map[i])];
+			}
+			return retval;
+		}
+	private:
+		container_type m_value;
+};
+
+template <typename T, std::size_t N>
+const typename fixed_monomial<T,N>::size_type fixed_monomial<T,N>::max_size;
+
+}
+
+namespace std
+{
+
+/// Specialisation of \p std::hash for piranha::fixed_monomial.
+template <typename T, std::size_t N>
+struct hash<piranha::fixed_monomial<T,N>>
+{
+	/// Result type.
+	typedef size_t result_type;
+	/// Argument type.
+	typedef piranha::fixed_monomial<T,N> argument_type;
+	/// Hash operator.
+	/**
+	 * @param[in] a argument whose hash value will be computed.
+	 *
+	 * @return hash value of \p a computed via piranha::fixed_monomial::hash().
+	 */
+	result_type operator()(const argument_type &a) const noexcept
+	{
+		return a.hash();
+	}
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <boost/numeric/conversion/cast.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <numeric>
@@ -31,9 +32,13 @@
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "config.hpp"
+#include "debug_access.hpp"
+#include "detail/kronecker_array_limits.hpp"
+#include "detail/kronecker_int.hpp"
 #include "exceptions.hpp"
 #include "mp_integer.hpp"
 #include "type_traits.hpp"
@@ -41,6 +46,40 @@
 namespace piranha
 {
 
+namespace detail
+{
+
+// Unsigned types used in the division-free decoding of Kronecker codes, selected according to the bit width
+// of the signed integer type: the magic numbers are stored in magic_t, and their products with the codes are
+// computed in dmagic_t. If no suitable types are available, hardware division is used.
+template <std::size_t Bits, typename = void>
+struct ka_magic_types
+{
+	static const bool value = false;
+	using magic_t = std::uintmax_t;
+	using dmagic_t = std::uintmax_t;
+};
+
+template <std::size_t Bits>
+struct ka_magic_types<Bits,typename std::enable_if<(Bits <= 32u)>::type>
+{
+	static const bool value = true;
+	using magic_t = std::uint_least32_t;
+	using dmagic_t = std::uint_least64_t;
+};
+
+#if defined(PIRANHA_UINT128_T)
+template <>
+struct ka_magic_types<64u>
+{
+	static const bool value = true;
+	using magic_t = std::uint_least64_t;
+	using dmagic_t = PIRANHA_UINT128_T;
+};
+#endif
+
+}
+
 /// Kronecker array.
 /**
  * This class offers static methods to encode (and decode) arrays of integral values as instances of \p SignedInteger type,
@@ -51,7 +90,8 @@ namespace piranha
  * 
  * \section type_requirements Type requirements
  * 
- * \p SignedInteger must be a C++ signed integral type with finite bounds.
+ * \p SignedInteger must be a C++ signed integral type with finite bounds or, if supported by the compiler, the 128-bit signed
+ * integer type. The limits for the 128-bit type are not tabulated and they are computed at startup.
  * 
  * \section exception_safety Exception safety guarantee
  * 
@@ -75,8 +115,7 @@ class kronecker_array
 		/// Signed integer type used for encoding.
 		typedef SignedInteger int_type;
 	private:
-		static_assert(std::is_integral<int_type>::value && std::is_signed<int_type>::value &&
-			std::numeric_limits<int_type>::is_bounded,"This class can be used only with bounded signed integers.");
+		static_assert(detail::ka_int_traits<int_type>::value,"This class can be used only with bounded signed integers.");
 		// This is a 4-tuple of int_type built as follows:
 		// 0. vector of absolute values of the upper/lower limit for each component,
 		// 1. h_min,
@@ -85,6 +124,8 @@ class kronecker_array
 		typedef std::tuple<std::vector<int_type>,int_type,int_type,int_type> limit_type;
 		// Vector of limits.
 		typedef std::vector<limit_type> limits_type;
+		template <typename T>
+		friend class debug_access;
 	public:
 		/// Size type.
 		/**
@@ -93,11 +134,40 @@ class kronecker_array
 		 */
 		typedef std::size_t size_type;
 	private:
-		// Static vector of limits built at startup.
+		// Unsigned counterpart of int_type.
+		typedef typename detail::ka_int_traits<int_type>::uint_type uint_type;
+		// Types for division-free decoding.
+		typedef detail::ka_magic_types<static_cast<std::size_t>(detail::ka_int_traits<int_type>::digits + 1u)> magic_types;
+		typedef typename magic_types::magic_t magic_t;
+		typedef typename magic_types::dmagic_t dmagic_t;
+		// Divisor used in the decoding of a component of a Kronecker code. The divisor d is the width 2 * M + 1
+		// of the component's range. The quotient of a non-negative code n by d is computed
+		// as (n * m_magic) >> m_shift, where m_shift is W + l, W being the number of value bits of int_type and l
+		// the smallest integer such that d <= 2**l, and m_magic is ceil(2**m_shift / d). This is exact for all
+		// n < 2**W (see Granlund and Montgomery, "Division by invariant integers using multiplication", 1994).
+		struct divisor_type
+		{
+			uint_type	m_d;
+			magic_t		m_magic;
+			unsigned	m_shift;
+		};
+		// Divisors for each dimension.
+		typedef std::vector<std::vector<divisor_type>> divisors_type;
+		// Static data built at startup: the limits and the corresponding divisors.
 		// NOTE: here we should not have problems when interoperating with libraries that modify the GMP allocation functions,
 		// as we do not store any static piranha::integer: the creation and destruction of integer objects is confined to the determine_limit()
-		// function.
-		static const limits_type m_limits;
+		// and compute_divisors() functions.
+		// NOTE: the limits are normally loaded from the precomputed tables in detail::kronecker_array_limits, as
+		// determine_limits() is expensive and it would be run by every process at startup.
+		// NOTE: limits and divisors are stored in the same object because the relative order of initialisation
+		// of the static data members of a class template is unspecified.
+		struct static_data
+		{
+			static_data():m_limits(load_limits()),m_divisors(compute_divisors(m_limits)) {}
+			const limits_type	m_limits;
+			const divisors_type	m_divisors;
+		};
+		static const static_data s_data;
 		// Determine limits for m-dimensional vectors.
 		static limit_type determine_limit(const size_type &m)
 		{
@@ -132,16 +202,16 @@ class kronecker_array
 				piranha_assert(diff >= 0);
 				try {
 					// Try to cast everything to hardware integers.
-					(void)static_cast<int_type>(h_min);
-					(void)static_cast<int_type>(h_max);
+					(void)detail::ka_from_integer<int_type>(h_min);
+					(void)detail::ka_from_integer<int_type>(h_max);
 					// Here it is +1 because h_max - h_min must be strictly less than the maximum value
 					// of int_type - see paper.
-					(void)static_cast<int_type>(diff + 1);
+					(void)detail::ka_from_integer<int_type>(diff + 1);
 					// NOTE: check casting individual elements too of m/M vec. This is because in the paper we assume
 					// m and M representable, but here we do not know really.
 					for (size_type i = 0u; i < M_vec.size(); ++i) {
-						(void)static_cast<int_type>(M_vec[i]);
-						(void)static_cast<int_type>(m_vec[i]);
+						(void)detail::ka_from_integer<int_type>(M_vec[i]);
+						(void)detail::ka_from_integer<int_type>(m_vec[i]);
 					}
 				} catch (const std::overflow_error &) {
 					std::vector<int_type> tmp;
@@ -151,13 +221,13 @@ class kronecker_array
 						// NOTE here that the check above on the components is such that here we are sure we can
 						// both cast to int_type and take the negative safely.
 						std::transform(prev_M_vec.begin(),prev_M_vec.end(),std::back_inserter(tmp),[](const integer &n) {
-							return static_cast<int_type>(n);
+							return detail::ka_from_integer<int_type>(n);
 						});
 						return std::make_tuple(
 							tmp,
-							static_cast<int_type>(h_min),
-							static_cast<int_type>(h_max),
-							static_cast<int_type>(h_max - h_min)
+							detail::ka_from_integer<int_type>(h_min),
+							detail::ka_from_integer<int_type>(h_max),
+							detail::ka_from_integer<int_type>(h_max - h_min)
 						);
 					} else {
 						// Here it means m variables are too many, and we stopped at the first iteration
@@ -209,6 +279,71 @@ class kronecker_array
 			}
 			return retval;
 		}
+		// Load the limits from the precomputed tables. If no table is available for int_type, the limits
+		// are computed at runtime.
+		static limits_type load_limits()
+		{
+			using table = detail::kronecker_array_limits<static_cast<std::size_t>(detail::ka_int_traits<int_type>::digits + 1u)>;
+			if (table::size == 0u) {
+				return determine_limits();
+			}
+			limits_type retval;
+			retval.push_back(std::make_tuple(std::vector<int_type>{},int_type(0),int_type(0),int_type(0)));
+			const long long *minmax_ptr = table::minmax(), *h_ptr = table::h();
+			for (size_type i = 1u; i < table::size; ++i, h_ptr += 3) {
+				std::vector<int_type> tmp;
+				for (size_type j = 0u; j < i; ++j, ++minmax_ptr) {
+					tmp.push_back(static_cast<int_type>(*minmax_ptr));
+				}
+				retval.push_back(std::make_tuple(std::move(tmp),static_cast<int_type>(h_ptr[0u]),
+					static_cast<int_type>(h_ptr[1u]),static_cast<int_type>(h_ptr[2u])));
+			}
+			// Check the consistency of the tables in debug mode.
+			piranha_assert(retval == determine_limits());
+			return retval;
+		}
+		static divisors_type compute_divisors(const limits_type &limits)
+		{
+			divisors_type retval;
+			for (const auto &limit: limits) {
+				std::vector<divisor_type> tmp;
+				for (const auto &M: std::get<0u>(limit)) {
+					divisor_type div;
+					div.m_d = static_cast<uint_type>(2 * M + 1);
+					div.m_magic = 0u;
+					div.m_shift = 0u;
+					compute_magic(div,std::integral_constant<bool,magic_types::value>());
+					tmp.push_back(div);
+				}
+				retval.push_back(std::move(tmp));
+			}
+			return retval;
+		}
+		static void compute_magic(divisor_type &div, const std::true_type &)
+		{
+			unsigned l = 0u;
+			while (integer(2).pow(l) < div.m_d) {
+				++l;
+			}
+			div.m_shift = detail::ka_int_traits<int_type>::digits + l;
+			const integer magic = (integer(2).pow(div.m_shift) + (div.m_d - 1u)) / div.m_d;
+			piranha_assert(magic <= std::numeric_limits<magic_t>::max());
+			div.m_magic = static_cast<magic_t>(magic);
+		}
+		static void compute_magic(divisor_type &, const std::false_type &) {}
+		// Quotient of a non-negative code by a divisor.
+		static uint_type div_impl(const uint_type &n, const divisor_type &d, const std::true_type &)
+		{
+			return static_cast<uint_type>((static_cast<dmagic_t>(n) * d.m_magic) >> d.m_shift);
+		}
+		static uint_type div_impl(const uint_type &n, const divisor_type &d, const std::false_type &)
+		{
+			return static_cast<uint_type>(n / d.m_d);
+		}
+		static uint_type div(const uint_type &n, const divisor_type &d)
+		{
+			return div_impl(n,d,std::integral_constant<bool,magic_types::value>());
+		}
 	public:
 		/// Get the limits of the Kronecker codification.
 		/**
@@ -231,7 +366,7 @@ class kronecker_array
 		 */
 		static const limits_type &get_limits()
 		{
-			return m_limits;
+			return s_data.m_limits;
 		}
 		/// Encode vector.
 		/**
@@ -255,28 +390,28 @@ class kronecker_array
 		{
 			const auto size = v.size();
 			// NOTE: here the check is >= because indices in the limits vector correspond to the sizes of the vectors to be encoded.
-			if (unlikely(size >= m_limits.size())) {
+			if (unlikely(size >= s_data.m_limits.size())) {
 				piranha_throw(std::invalid_argument,"size of vector to be encoded is too large");
 			}
 			if (unlikely(!size)) {
 				return int_type(0);
 			}
 			// Cache quantities.
-			const auto &limit = m_limits[size];
+			const auto &limit = s_data.m_limits[size];
 			const auto &minmax_vec = std::get<0u>(limit);
 			// Check that the vector's components are compatible with the limits.
-			// NOTE: here size is not greater than m_limits.size(), which in turn is compatible with the minmax vectors.
+			// NOTE: here size is not greater than s_data.m_limits.size(), which in turn is compatible with the minmax vectors.
 			for (min_int<decltype(v.size()),decltype(minmax_vec.size())> i = 0u; i < size; ++i) {
-				if (unlikely(boost::numeric_cast<int_type>(v[i]) < -minmax_vec[i] || boost::numeric_cast<int_type>(v[i]) > minmax_vec[i])) {
+				if (unlikely(detail::ka_numeric_cast<int_type>(v[i]) < -minmax_vec[i] || detail::ka_numeric_cast<int_type>(v[i]) > minmax_vec[i])) {
 					piranha_throw(std::invalid_argument,"a component of the vector to be encoded is out of bounds");
 				}
 			}
 			piranha_assert(minmax_vec[0u] > 0);
-			int_type retval = static_cast<int_type>(boost::numeric_cast<int_type>(v[0u]) + minmax_vec[0u]),
+			int_type retval = static_cast<int_type>(detail::ka_numeric_cast<int_type>(v[0u]) + minmax_vec[0u]),
 				cur_c = static_cast<int_type>(2 * minmax_vec[0u] + 1);
 			piranha_assert(retval >= 0);
 			for (decltype(v.size()) i = 1u; i < size; ++i) {
-				retval = static_cast<int_type>(retval + ((boost::numeric_cast<int_type>(v[i]) + minmax_vec[i]) * cur_c));
+				retval = static_cast<int_type>(retval + ((detail::ka_numeric_cast<int_type>(v[i]) + minmax_vec[i]) * cur_c));
 				piranha_assert(minmax_vec[i] > 0);
 				cur_c = static_cast<int_type>(cur_c * (2 * minmax_vec[i] + 1));
 			}
@@ -307,7 +442,7 @@ class kronecker_array
 		{
 			typedef typename Vector::value_type v_type;
 			const auto m = retval.size();
-			if (unlikely(m >= m_limits.size())) {
+			if (unlikely(m >= s_data.m_limits.size())) {
 				piranha_throw(std::invalid_argument,"size of vector to be decoded is too large");
 			}
 			if (unlikely(!m)) {
@@ -317,7 +452,7 @@ class kronecker_array
 				return;
 			}
 			// Cache values.
-			const auto &limit = m_limits[m];
+			const auto &limit = s_data.m_limits[m];
 			const auto &minmax_vec = std::get<0u>(limit);
 			const auto hmin = std::get<1u>(limit), hmax = std::get<2u>(limit);
 			if (unlikely(n < hmin || n > hmax)) {
@@ -326,23 +461,138 @@ class kronecker_array
 			// NOTE: the static_cast here is useful when working with int_type == char. In that case,
 			// the binary operation on the RHS produces an int (due to integer promotion rules), which gets
 			// assigned back to char causing the compiler to complain about potentially lossy conversion.
-			const int_type code = static_cast<int_type>(n - hmin);
-			piranha_assert(code >= 0);
-			piranha_assert(minmax_vec[0u] > 0);
-			int_type mod_arg = static_cast<int_type>(2 * minmax_vec[0u] + 1);
-			// Do the first value manually.
-			retval[0u] = boost::numeric_cast<v_type>((code % mod_arg) - minmax_vec[0u]);
-			for (min_int<typename Vector::size_type,decltype(minmax_vec.size())> i = 1u; i < m; ++i) {
+			piranha_assert(static_cast<int_type>(n - hmin) >= 0);
+			uint_type code = static_cast<uint_type>(n - hmin);
+			const auto &divisors = s_data.m_divisors[m];
+			// Each component is the remainder of the division of the code by the component's divisor,
+			// the quotient being the code for the remaining components.
+			for (min_int<typename Vector::size_type,decltype(minmax_vec.size())> i = 0u; i < m; ++i) {
 				piranha_assert(minmax_vec[i] > 0);
-				retval[i] = boost::numeric_cast<v_type>((code % (mod_arg * (2 * minmax_vec[i] + 1))) / mod_arg - minmax_vec[i]);
-				mod_arg = static_cast<int_type>(mod_arg * (2 * minmax_vec[i] + 1));
+				const uint_type q = div(code,divisors[i]);
+				retval[i] = detail::ka_numeric_cast<v_type>(static_cast<int_type>(code - q * divisors[i].m_d) - minmax_vec[i]);
+				code = q;
+			}
+		}
+		/// Sign of the first nonzero component.
+		/**
+		 * Compute the sign of the first nonzero component of the \p m-dimensional vector encoded by \p n, without decoding
+		 * the whole vector. Since the ranges of the components are symmetric, the code of a vector is the opposite of
+		 * the code of the opposite vector: this method, together with the negation of the code, can thus be used to
+		 * normalise the sign of an encoded vector.
+		 * 
+		 * The components are decoded starting from the first one, and the decoding stops at the first nonzero component.
+		 * 
+		 * @param[in] n code of the vector.
+		 * @param[in] m size of the encoded vector.
+		 * 
+		 * @return 1 if the first nonzero component of the vector is positive, -1 if it is negative, 0 if all the components are zero.
+		 * 
+		 * @throws std::invalid_argument if any of these conditions hold:
+		 * - \p m is equal to or greater than the size of the output of get_limits(),
+		 * - \p m is zero and \p n is not zero,
+		 * - \p n is out of the allowed bounds reported by get_limits().
+		 */
+		static int first_nonzero_sign(const int_type &n, const size_type &m)
+		{
+			if (unlikely(m >= s_data.m_limits.size())) {
+				piranha_throw(std::invalid_argument,"size of vector to be decoded is too large");
+			}
+			if (unlikely(!m)) {
+				if (unlikely(n != 0)) {
+					piranha_throw(std::invalid_argument,"a vector of size 0 must always be encoded as 0");
+				}
+				return 0;
+			}
+			const auto &limit = s_data.m_limits[m];
+			const auto &minmax_vec = std::get<0u>(limit);
+			const auto hmin = std::get<1u>(limit), hmax = std::get<2u>(limit);
+			if (unlikely(n < hmin || n > hmax)) {
+				piranha_throw(std::invalid_argument,"the integer to be decoded is out of bounds");
+			}
+			// NOTE: only the zero vector is encoded as zero, no need to decode anything.
+			if (n == 0) {
+				return 0;
+			}
+			uint_type code = static_cast<uint_type>(n - hmin);
+			const auto &divisors = s_data.m_divisors[m];
+			for (size_type i = 0u; i < m; ++i) {
+				const uint_type q = div(code,divisors[i]);
+				const int_type c = static_cast<int_type>(static_cast<int_type>(code - q * divisors[i].m_d) - minmax_vec[i]);
+				if (c != 0) {
+					return (c > 0) ? 1 : -1;
+				}
+				code = q;
+			}
+			piranha_assert(false);
+			return 0;
+		}
+		/// Decode many codes at once.
+		/**
+		 * Decode the \p n codes in the range starting at \p codes into \p m-dimensional vectors, which will be written
+		 * to the range starting at \p out. The output is stored component-wise: the component of index \p i of the vector decoded
+		 * from the code of index \p j is written to <tt>out[i * n + j]</tt>. This layout allows to process in the inner loops
+		 * contiguous sequences of codes and components, which the compiler can vectorise.
+		 *
+		 * In case of exceptions, the content of \p out is undefined.
+		 *
+		 * @param[out] out start of the output range, which must contain at least <tt>m * n</tt> elements.
+		 * @param[in] m size of the vectors to be decoded.
+		 * @param[in] codes start of the range of codes to be decoded.
+		 * @param[in] n number of codes to be decoded.
+		 *
+		 * @throws std::invalid_argument if any of these conditions hold:
+		 * - \p m is equal to or greater than the size of the output of get_limits(),
+		 * - \p m is zero and any of the codes is not zero,
+		 * - any of the codes is out of the allowed bounds reported by get_limits().
+		 */
+		static void decode_n(int_type *out, const size_type &m, const int_type *codes, const size_type &n)
+		{
+			if (unlikely(m >= s_data.m_limits.size())) {
+				piranha_throw(std::invalid_argument,"size of vector to be decoded is too large");
+			}
+			if (unlikely(!n)) {
+				return;
+			}
+			piranha_assert(out && codes);
+			const auto minmax = std::minmax_element(codes,codes + n);
+			if (unlikely(!m)) {
+				if (unlikely(*minmax.first != 0 || *minmax.second != 0)) {
+					piranha_throw(std::invalid_argument,"a vector of size 0 must always be encoded as 0");
+				}
+				return;
+			}
+			const auto &limit = s_data.m_limits[m];
+			const auto &minmax_vec = std::get<0u>(limit);
+			const auto hmin = std::get<1u>(limit), hmax = std::get<2u>(limit);
+			if (unlikely(*minmax.first < hmin || *minmax.second > hmax)) {
+				piranha_throw(std::invalid_argument,"the integer to be decoded is out of bounds");
+			}
+			const auto &divisors = s_data.m_divisors[m];
+			// The codes are processed in blocks, storing the partial quotients in a local buffer.
+			const size_type block_size = 256u;
+			uint_type buffer[block_size];
+			for (size_type start = 0u; start < n; start += block_size) {
+				const size_type size = std::min(block_size,static_cast<size_type>(n - start));
+				for (size_type j = 0u; j < size; ++j) {
+					buffer[j] = static_cast<uint_type>(codes[start + j] - hmin);
+				}
+				for (size_type i = 0u; i < m; ++i) {
+					const divisor_type d = divisors[i];
+					const int_type M = minmax_vec[i];
+					int_type *out_ptr = out + i * n + start;
+					for (size_type j = 0u; j < size; ++j) {
+						const uint_type q = div(buffer[j],d);
+						out_ptr[j] = static_cast<int_type>(static_cast<int_type>(buffer[j] - q * d.m_d) - M);
+						buffer[j] = q;
+					}
+				}
 			}
 		}
 };
 
 // Static initialization.
 template <typename SignedInteger>
-const typename kronecker_array<SignedInteger>::limits_type kronecker_array<SignedInteger>::m_limits = kronecker_array<SignedInteger>::determine_limits();
+const typename kronecker_array<SignedInteger>::static_data kronecker_array<SignedInteger>::s_data;
 
 }
 
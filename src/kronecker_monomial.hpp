@@ -107,7 +107,7 @@ class kronecker_monomial
 		template <typename U, typename = void>
 		struct eval_type {};
 		template <typename U>
-		using e_type = decltype(math::pow(std::declval<U const &>(),std::declval<value_type const &>()));
+		using e_type = decltype(math::pow(std::declval<U const &>(),detail::ka_expo(std::declval<value_type const &>())));
 		template <typename U>
 		struct eval_type<U,typename std::enable_if<is_multipliable_in_place<e_type<U>>::value &&
 			std::is_constructible<e_type<U>,int>::value>::type>
@@ -117,6 +117,42 @@ class kronecker_monomial
 	public:
 		/// Vector type used for temporary packing/unpacking.
 		typedef static_vector<value_type,max_size> v_type;
+	private:
+		// Packed-domain arithmetic. The Kronecker code of a vector is the dot product of the vector with
+		// the coding weights, so the exponent-wise sum/difference of two monomials is encoded by the sum/difference
+		// of the codes, provided that the resulting exponents are within the limits. Here we check that condition
+		// on the unpacked operands (if Sub is true, the exponents of v2 are subtracted from those of v1).
+		// NOTE: the components of v1 and v2 are bounded by M_i, and 2 * M_i + 1 is representable, so
+		// no overflow can occur.
+		template <bool Sub>
+		static bool packed_in_bounds(const v_type &v1, const v_type &v2)
+		{
+			piranha_assert(v1.size() == v2.size());
+			if (!v1.size()) {
+				return true;
+			}
+			const auto &minmax_vec = std::get<0u>(ka::get_limits()[static_cast<size_type>(v1.size())]);
+			for (typename v_type::size_type i = 0u; i < v1.size(); ++i) {
+				const auto tmp = static_cast<value_type>(Sub ? v1[i] - v2[i] : v1[i] + v2[i]);
+				if (tmp > minmax_vec[i] || tmp < -minmax_vec[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+		// Checked exponent-wise sum/difference of unpacked monomials.
+		template <bool Sub>
+		static v_type combine_exponents(const v_type &v1, const v_type &v2)
+		{
+			piranha_assert(v1.size() == v2.size());
+			v_type retval;
+			for (typename v_type::size_type i = 0u; i < v1.size(); ++i) {
+				retval.push_back(v1[i]);
+				detail::km_safe_adder(retval[i],Sub ? static_cast<value_type>(-v2[i]) : v2[i]);
+			}
+			return retval;
+		}
+	public:
 		/// Default constructor.
 		/**
 		 * After construction all exponents in the monomial will be zero.
@@ -144,7 +180,7 @@ class kronecker_monomial
 		{
 			v_type tmp;
 			for (const auto &x: list) {
-				tmp.push_back(boost::numeric_cast<value_type>(x));
+				tmp.push_back(detail::ka_numeric_cast<value_type>(x));
 			}
 			m_value = ka::encode(tmp);
 		}
@@ -170,7 +206,7 @@ class kronecker_monomial
 		{
 			typedef typename std::iterator_traits<Iterator>::value_type it_v_type;
 			v_type tmp;
-			std::transform(start,end,std::back_inserter(tmp),[](const it_v_type &v) {return boost::numeric_cast<value_type>(v);});
+			std::transform(start,end,std::back_inserter(tmp),[](const it_v_type &v) {return detail::ka_numeric_cast<value_type>(v);});
 			m_value = ka::encode(tmp);
 		}
 		/// Constructor from set of symbols.
@@ -330,13 +366,12 @@ class kronecker_monomial
 		 * 
 		 * @return degree of the monomial.
 		 * 
-		 * @throws std::overflow_error if the computation of the degree overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type degree(const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_degree<value_type>(tmp,detail::km_safe_adder<value_type>,args);
+			return detail::monomial_degree<value_type>(tmp,detail::km_bounded_adder<value_type>,args);
 		}
 		/// Low degree.
 		/**
@@ -363,13 +398,12 @@ class kronecker_monomial
 		 * @return the summation of all the exponents of the monomial corresponding to the symbols in
 		 * \p active_args, or <tt>value_type(0)</tt> if no symbols in \p active_args appear in \p args.
 		 * 
-		 * @throws std::overflow_error if the computation of the degree overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type degree(const std::set<std::string> &active_args, const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_partial_degree<value_type>(tmp,detail::km_safe_adder<value_type>,active_args,args);
+			return detail::monomial_partial_degree<value_type>(tmp,detail::km_bounded_adder<value_type>,active_args,args);
 		}
 		/// Partial low degree.
 		/**
@@ -386,13 +420,61 @@ class kronecker_monomial
 		{
 			return degree(active_args,args);
 		}
+		/// Partial degree from positions.
+		/**
+		 * Equivalent to the partial degree, but the symbols to be considered are identified by their positions
+		 * in \p args. The monomial is not decoded if \p p is empty.
+		 * 
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 * 
+		 * @return the summation of all the exponents of the monomial corresponding to the positions in \p p.
+		 * 
+		 * @throws std::invalid_argument if the positions in \p p are not compatible with \p args.
+		 * @throws unspecified any exception thrown by unpack().
+		 */
+		value_type degree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			if (!p.size()) {
+				if (unlikely(!is_compatible(args))) {
+					piranha_throw(std::invalid_argument,"invalid symbol set");
+				}
+				return value_type(0);
+			}
+			const auto tmp = unpack(args);
+			return detail::monomial_partial_degree<value_type>(tmp,detail::km_bounded_adder<value_type>,p,args);
+		}
+		/// Partial low degree from positions.
+		/**
+		 * Equivalent to the partial degree from positions.
+		 * 
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial low degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 * 
+		 * @return the partial low degree.
+		 * 
+		 * @throws unspecified any exception thrown by degree().
+		 */
+		value_type ldegree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			return degree(p,args);
+		}
 		/// Multiply monomial.
 		/**
 		 * The resulting monomial is computed by adding the exponents of \p this to the exponents of \p other.
+		 * Since Kronecker substitution is linear, the computation is performed directly on the packed integers
+		 * after the bounds of the resulting exponents have been verified.
+		 * 
+		 * If \p bounds_checked is \p true, the caller guarantees that the exponents of the result are within the limits
+		 * reported by piranha::kronecker_array::get_limits() (e.g., because the ranges of the exponents of the operands
+		 * have been checked in advance, as done in the polynomial multiplier). In this case
+		 * the result is computed with a single integral addition, no check is performed (apart from debug mode assertions)
+		 * and this method will not throw.
 		 * 
 		 * @param[out] retval result of multiplying \p this by \p other.
 		 * @param[in] other multiplicand.
 		 * @param[in] args reference set of piranha::symbol.
+		 * @param[in] bounds_checked \p true if the bounds of the result are known to be valid.
 		 * 
 		 * @throws std::overflow_error if the computation of the result overflows type \p value_type.
 		 * @throws unspecified any exception thrown by:
@@ -400,19 +482,58 @@ class kronecker_monomial
 		 * - unpack(),
 		 * - piranha::static_vector::push_back().
 		 */
-		void multiply(kronecker_monomial &retval, const kronecker_monomial &other, const symbol_set &args) const
+		void multiply(kronecker_monomial &retval, const kronecker_monomial &other, const symbol_set &args, bool bounds_checked = false) const
 		{
-			const auto size = args.size();
+			if (bounds_checked) {
+				piranha_assert(packed_in_bounds<false>(unpack(args),other.unpack(args)));
+				retval.m_value = static_cast<value_type>(m_value + other.m_value);
+				return;
+			}
 			const auto tmp1 = unpack(args), tmp2 = other.unpack(args);
-			v_type result;
-			for (typename v_type::size_type i = 0u; i < size; ++i) {
-				result.push_back(tmp1[i]);
-				detail::km_safe_adder(result[i],tmp2[i]);
+			if (likely(packed_in_bounds<false>(tmp1,tmp2))) {
+				retval.m_value = static_cast<value_type>(m_value + other.m_value);
+				return;
 			}
-			retval.m_value = ka::encode(result);
+			// Slow path, used only to report the error.
+			retval.m_value = ka::encode(combine_exponents<false>(tmp1,tmp2));
+		}
+		/// Divide monomial.
+		/**
+		 * The resulting monomial is computed by subtracting the exponents of \p other from the exponents of \p this.
+		 * The semantics of \p bounds_checked and the implementation strategy are the same as in multiply().
+		 * 
+		 * @param[out] retval result of dividing \p this by \p other.
+		 * @param[in] other divisor.
+		 * @param[in] args reference set of piranha::symbol.
+		 * @param[in] bounds_checked \p true if the bounds of the result are known to be valid.
+		 * 
+		 * @throws std::overflow_error if the computation of the result overflows type \p value_type.
+		 * @throws unspecified any exception thrown by:
+		 * - piranha::kronecker_array::encode(),
+		 * - unpack(),
+		 * - piranha::static_vector::push_back().
+		 */
+		void divide(kronecker_monomial &retval, const kronecker_monomial &other, const symbol_set &args, bool bounds_checked = false) const
+		{
+			if (bounds_checked) {
+				piranha_assert(packed_in_bounds<true>(unpack(args),other.unpack(args)));
+				retval.m_value = static_cast<value_type>(m_value - other.m_value);
+				return;
+			}
+			const auto tmp1 = unpack(args), tmp2 = other.unpack(args);
+			if (likely(packed_in_bounds<true>(tmp1,tmp2))) {
+				retval.m_value = static_cast<value_type>(m_value - other.m_value);
+				return;
+			}
+			retval.m_value = ka::encode(combine_exponents<true>(tmp1,tmp2));
 		}
 		/// Hash value.
 		/**
+		 * If \p T is wider than \p std::size_t (e.g., the 128-bit integer), the cast folds the internal integer
+		 * modulo \f$ 2^N \f$, \f$ N \f$ being the bit width of \p std::size_t. Contrary to other folding schemes
+		 * (e.g., xoring the high and low halves), this preserves the additivity of the Kronecker codes, which is exploited by
+		 * the series multipliers to predict the destination bucket of a product.
+		 * 
 		 * @return the internal integer instance, cast to \p std::size_t.
 		 */
 		std::size_t hash() const
@@ -460,7 +581,7 @@ class kronecker_monomial
 			for (typename v_type::size_type i = 0u; i < size; ++i) {
 				integer tmp;
 				try {
-					tmp = math::integral_cast(v[i]);
+					tmp = math::integral_cast(detail::ka_expo(v[i]));
 				} catch (const std::invalid_argument &) {
 					piranha_throw(std::invalid_argument,"exponent is not an integer");
 				}
@@ -485,7 +606,8 @@ class kronecker_monomial
 		 *
 		 * Will return a monomial corresponding to \p this raised to the <tt>x</tt>-th power. The exponentiation
 		 * is computed via multiplication of the exponents by the output of piranha::math::integral_cast()
-		 * on \p x.
+		 * on \p x. If the exponents of the result are within the limits of piranha::kronecker_array, the
+		 * multiplication is performed directly on the packed integer.
 		 * 
 		 * @param[in] x exponent.
 		 * @param[in] args reference set of piranha::symbol.
@@ -504,10 +626,30 @@ class kronecker_monomial
 			auto v = unpack(args);
 			const auto size = args.size();
 			const integer n = math::integral_cast(x);
+			// Packed fast path.
+			if (size && n >= -detail::ka_to_integer(detail::ka_int_traits<value_type>::max()) &&
+				n <= detail::ka_to_integer(detail::ka_int_traits<value_type>::max()))
+			{
+				const auto n_v = detail::ka_from_integer<value_type>(n);
+				const value_type abs_n = (n_v >= value_type(0)) ? n_v : static_cast<value_type>(-n_v);
+				const auto &minmax_vec = std::get<0u>(ka::get_limits()[static_cast<size_type>(size)]);
+				typename v_type::size_type i = 0u;
+				// NOTE: |v[i] * n| <= M_i iff |v[i]| <= M_i / |n|, and the bounds of the Kronecker array are symmetric.
+				for (; abs_n != value_type(0) && i < size; ++i) {
+					if (v[i] > minmax_vec[i] / abs_n || v[i] < -(minmax_vec[i] / abs_n)) {
+						break;
+					}
+				}
+				if (abs_n == value_type(0) || i == size) {
+					kronecker_monomial retval;
+					retval.m_value = static_cast<value_type>(n_v * m_value);
+					return retval;
+				}
+			}
 			for (typename v_type::size_type i = 0u; i < size; ++i) {
 				// NOTE: here operator* produces an integer, which is safely cast back
 				// to the signed int type.
-				v[i] = static_cast<value_type>(n * v[i]);
+				v[i] = detail::ka_from_integer<value_type>(n * detail::ka_expo(v[i]));
 			}
 			kronecker_monomial retval;
 			retval.m_value = ka::encode(v);
@@ -552,7 +694,7 @@ class kronecker_monomial
 					os << args[i].get_name();
 					empty_output = false;
 					if (tmp[i] != one) {
-						os << "**" << detail::prepare_for_print(tmp[i]);
+						os << "**" << detail::prepare_for_print(detail::ka_expo(tmp[i]));
 					}
 				}
 			}
@@ -579,7 +721,7 @@ class kronecker_monomial
 					cur_oss = (cur_value > zero) ? std::addressof(oss_num) : (math::negate(cur_value),std::addressof(oss_den));
 					(*cur_oss) << "{" << args[i].get_name() << "}";
 					if (cur_value != one) {
-						(*cur_oss) << "^{" << static_cast<long long>(cur_value) << "}";
+						(*cur_oss) << "^{" << detail::prepare_for_print(detail::ka_expo(cur_value)) << "}";
 					}
 				}
 			}
@@ -615,8 +757,8 @@ class kronecker_monomial
 			auto v = unpack(args);
 			for (min_int<typename v_type::size_type,decltype(args.size())> i = 0u; i < args.size(); ++i) {
 				if (args[i] == s && !math::is_zero(v[i])) {
-					integer tmp_n(v[i]);
-					v[i] = static_cast<value_type>(tmp_n - 1);
+					integer tmp_n(detail::ka_to_integer(v[i]));
+					v[i] = detail::ka_from_integer<value_type>(tmp_n - 1);
 					kronecker_monomial tmp_km;
 					tmp_km.m_value = ka::encode(v);
 					return std::make_pair(std::move(tmp_n),std::move(tmp_km));
@@ -662,7 +804,7 @@ class kronecker_monomial
 				if (args[i] == s) {
 					// NOTE: here using i is safe: if retval gained an extra exponent in the condition above,
 					// we are never going to land here as args[i] is at this point never going to be s.
-					retval[i] = static_cast<value_type>(integer(retval[i]) + 1);
+					retval[i] = detail::ka_from_integer<value_type>(detail::ka_to_integer(retval[i]) + 1);
 					if (math::is_zero(retval[i])) {
 						piranha_throw(std::invalid_argument,"unable to perform monomial integration: negative unitary exponent");
 					}
@@ -674,7 +816,7 @@ class kronecker_monomial
 				retval.push_back(one);
 				expo = one;
 			}
-			return std::make_pair(integer(expo),kronecker_monomial(ka::encode(retval)));
+			return std::make_pair(detail::ka_to_integer(expo),kronecker_monomial(ka::encode(retval)));
 		}
 		/// Evaluation.
 		/**
@@ -714,7 +856,7 @@ class kronecker_monomial
 						std::string("cannot evaluate monomial: symbol \'") + args[i].get_name() +
 						"\' does not appear in dictionary");
 				}
-				retval *= math::pow(it->second,v[i]);
+				retval *= math::pow(it->second,detail::ka_expo(v[i]));
 			}
 			return retval;
 		}
@@ -744,9 +886,13 @@ class kronecker_monomial
 			const auto v = unpack(args);
 			v_type new_v;
 			s_type retval_s(1);
+			// If s is not in args, the key is unchanged and there is no need to re-encode.
+			if (!std::binary_search(args.begin(),args.end(),s)) {
+				return std::make_pair(std::move(retval_s),*this);
+			}
 			for (min_int<typename v_type::size_type,decltype(args.size())> i = 0u; i < args.size(); ++i) {
 				if (args[i] == s) {
-					retval_s = math::pow(x,v[i]);
+					retval_s = math::pow(x,detail::ka_expo(v[i]));
 				} else {
 					new_v.push_back(v[i]);
 				}
@@ -782,20 +928,29 @@ class kronecker_monomial
 		{
 			typedef typename eval_type<U>::type s_type;
 			const auto v = unpack(args);
-			v_type new_v;
 			s_type retval_s(1);
+			value_type new_value = m_value;
+			if (!v.size()) {
+				return std::make_pair(std::move(retval_s),kronecker_monomial(new_value));
+			}
+			const auto &minmax_vec = std::get<0u>(ka::get_limits()[static_cast<size_type>(v.size())]);
+			// Coding weight of the current component.
+			value_type c(1);
 			for (min_int<typename v_type::size_type,decltype(args.size())> i = 0u; i < args.size(); ++i) {
-				new_v.push_back(v[i]);
 				if (args[i] == s) {
-					const rational tmp(math::integral_cast(v[i]),n);
+					const rational tmp(math::integral_cast(detail::ka_expo(v[i])),n);
 					if (tmp >= 1) {
 						const auto tmp_t = static_cast<integer>(tmp);
 						retval_s = math::pow(x,tmp_t);
-						new_v[i] -= tmp_t * n;
+						// NOTE: the new exponent has the same sign as v[i] (or it is zero) and a smaller absolute value,
+						// hence the new code is within the limits and it can be computed in the packed domain.
+						new_value = static_cast<value_type>(new_value - detail::ka_from_integer<value_type>(tmp_t * n) * c);
 					}
+					break;
 				}
+				c = static_cast<value_type>(c * (2 * minmax_vec[i] + 1));
 			}
-			return std::make_pair(std::move(retval_s),kronecker_monomial(ka::encode(new_v)));
+			return std::make_pair(std::move(retval_s),kronecker_monomial(new_value));
 		}
 		/// Identify symbols that can be trimmed.
 		/**
@@ -0,0 +1,776 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#ifndef PIRANHA_MODULAR_INTEGER_HPP
+#define PIRANHA_MODULAR_INTEGER_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "config.hpp"
+#include "exceptions.hpp"
+#include "math.hpp"
+#include "mp_integer.hpp"
+#include "type_traits.hpp"
+
+namespace piranha
+{
+
+namespace detail
+{
+
+// Types interoperable with modular_integer.
+template <typename T>
+struct is_modular_integer_interoperable_type
+{
+	static const bool value = (std::is_integral<T>::value && !std::is_same<T,bool>::value) ||
+		is_mp_integer<T>::value;
+};
+
+}
+
+/// Integers modulo a prime.
+/**
+ * This class represents elements of the finite field of integers modulo the prime \p P. The value is stored
+ * in a single 32-bit machine word in Montgomery form (with \f$ R = 2^{32} \f$), so that multiplications
+ * require no divisions. The main use of this class is as a coefficient type for polynomials whose
+ * integral coefficients are reconstructed via the Chinese remainder theorem after the multiplication
+ * (see piranha::tuning::get_crt_multiplication()), but it can also be used on its own to compute, e.g.,
+ * polynomial GCDs and factorisations over finite fields.
+ *
+ * \p P must be an odd prime smaller than \f$ 2^{31} \f$. The primality of \p P is not checked: if \p P is not prime,
+ * addition, subtraction and multiplication will still work as in the ring of integers modulo \p P, but inversion
+ * and division will produce meaningless results.
+ *
+ * \section interop Interoperability with other types
+ *
+ * This class interoperates with all C++ integral types (except \p bool) and with piranha::mp_integer.
+ * The result of binary operations involving interoperable types is always piranha::modular_integer.
+ *
+ * \section exception_safety Exception safety guarantee
+ *
+ * Unless noted otherwise, this class provides the strong exception safety guarantee for all operations.
+ * All the operations that do not involve piranha::mp_integer or divisions are \p noexcept.
+ *
+ * \section move_semantics Move semantics
+ *
+ * Move semantics is equivalent to copy semantics.
+ *
+ * @see http://en.wikipedia.org/wiki/Montgomery_reduction
+ *
+ * @author Francesco Biscani (bluescarni@gmail.com)
+ */
+template <std::uint_least32_t P>
+class modular_integer
+{
+		static_assert(P > 2u && P % 2u == 1u && P < (std::uint_least32_t(1) << 31u),
+			"The modulus of modular_integer must be an odd prime smaller than 2**31.");
+		// Shortcut for interop type detector.
+		template <typename T>
+		using is_interoperable_type = detail::is_modular_integer_interoperable_type<T>;
+		// Enabler for generic ctor.
+		template <typename T>
+		using generic_ctor_enabler = typename std::enable_if<is_interoperable_type<T>::value,int>::type;
+		// Enabler for in-place arithmetic operations.
+		template <typename T>
+		using in_place_enabler = typename std::enable_if<is_interoperable_type<T>::value ||
+			std::is_same<T,modular_integer>::value,int>::type;
+		// Montgomery constants.
+		// NOTE: these are functions rather than static data members in order to avoid the need
+		// of out-of-class definitions when they are odr-used.
+		static constexpr std::uint_least32_t mask() noexcept
+		{
+			return std::uint_least32_t(0xFFFFFFFFul);
+		}
+		// Inverse of P modulo 2**32, via Newton iteration. P * P == 1 mod 8, so the starting
+		// value is correct to 3 bits and each iteration doubles the number of correct bits.
+		static constexpr std::uint_least32_t inv_iter(std::uint_least32_t x, unsigned n) noexcept
+		{
+			return n ? inv_iter(static_cast<std::uint_least32_t>((x * (2u - P * x)) & mask()),n - 1u) : x;
+		}
+		// -P**-1 mod 2**32.
+		static constexpr std::uint_least32_t pinv() noexcept
+		{
+			return static_cast<std::uint_least32_t>((0u - inv_iter(P,4u)) & mask());
+		}
+		// R**2 mod P, that is, 2**64 mod P.
+		static constexpr std::uint_least32_t r2() noexcept
+		{
+			return static_cast<std::uint_least32_t>(((std::uint_least64_t(0xFFFFFFFFFFFFFFFFull) % P) + 1u) % P);
+		}
+		// Montgomery reduction: returns t * R**-1 mod P, requires t < P * R.
+		static std::uint_least32_t redc(const std::uint_least64_t &t) noexcept
+		{
+			const std::uint_least64_t m = (static_cast<std::uint_least64_t>(t & mask()) * pinv()) & mask();
+			// NOTE: here t < P * 2**32 and m * P < P * 2**32, so the sum is less than 2**64 as P < 2**31.
+			const std::uint_least64_t u = (t + m * P) >> 32u;
+			return static_cast<std::uint_least32_t>(u >= P ? u - P : u);
+		}
+		static std::uint_least32_t to_montgomery(const std::uint_least32_t &n) noexcept
+		{
+			piranha_assert(n < P);
+			return redc(static_cast<std::uint_least64_t>(n) * r2());
+		}
+		static std::uint_least32_t mod_add(const std::uint_least32_t &a, const std::uint_least32_t &b) noexcept
+		{
+			// NOTE: no overflow here, as both operands are less than 2**31.
+			const std::uint_least32_t s = static_cast<std::uint_least32_t>(a + b);
+			return (s >= P) ? static_cast<std::uint_least32_t>(s - P) : s;
+		}
+		static std::uint_least32_t mod_sub(const std::uint_least32_t &a, const std::uint_least32_t &b) noexcept
+		{
+			return (a >= b) ? static_cast<std::uint_least32_t>(a - b) : static_cast<std::uint_least32_t>(a + (P - b));
+		}
+		static std::uint_least32_t mod_mul(const std::uint_least32_t &a, const std::uint_least32_t &b) noexcept
+		{
+			return redc(static_cast<std::uint_least64_t>(a) * b);
+		}
+		// Reduction of interoperable types to canonical representatives in [0,P).
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce(const T &n) noexcept
+		{
+			long long r = static_cast<long long>(n) % static_cast<long long>(P);
+			if (r < 0) {
+				r += static_cast<long long>(P);
+			}
+			return static_cast<std::uint_least32_t>(r);
+		}
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce(const T &n) noexcept
+		{
+			return static_cast<std::uint_least32_t>(static_cast<unsigned long long>(n) % P);
+		}
+		template <typename T, typename std::enable_if<detail::is_mp_integer<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce(const T &n)
+		{
+			T r(n % P);
+			if (r.sign() < 0) {
+				r += P;
+			}
+			return static_cast<std::uint_least32_t>(r);
+		}
+		// Reduction of exponents modulo P - 1 (Fermat's little theorem).
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce_exponent(const T &n) noexcept
+		{
+			long long r = static_cast<long long>(n) % static_cast<long long>(P - 1u);
+			if (r < 0) {
+				r += static_cast<long long>(P - 1u);
+			}
+			return static_cast<std::uint_least32_t>(r);
+		}
+		template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce_exponent(const T &n) noexcept
+		{
+			return static_cast<std::uint_least32_t>(static_cast<unsigned long long>(n) % (P - 1u));
+		}
+		template <typename T, typename std::enable_if<detail::is_mp_integer<T>::value,int>::type = 0>
+		static std::uint_least32_t reduce_exponent(const T &n)
+		{
+			T r(n % (P - 1u));
+			if (r.sign() < 0) {
+				r += P - 1u;
+			}
+			return static_cast<std::uint_least32_t>(r);
+		}
+		// Exponentiation by squaring with a non-negative exponent.
+		modular_integer upow(std::uint_least32_t n) const noexcept
+		{
+			modular_integer retval(1), b(*this);
+			while (n) {
+				if (n & 1u) {
+					retval.m_value = mod_mul(retval.m_value,b.m_value);
+				}
+				n >>= 1u;
+				if (n) {
+					b.m_value = mod_mul(b.m_value,b.m_value);
+				}
+			}
+			return retval;
+		}
+		// Binary operations.
+		template <typename T, typename U>
+		using binary_op_enabler = typename std::enable_if<
+			(std::is_same<T,modular_integer>::value && is_interoperable_type<U>::value) ||
+			(std::is_same<U,modular_integer>::value && is_interoperable_type<T>::value) ||
+			(std::is_same<T,modular_integer>::value && std::is_same<U,modular_integer>::value),int>::type;
+		// Convert argument to the type of the operation.
+		template <typename T>
+		static const modular_integer &to_mi(const T &x, typename std::enable_if<std::is_same<T,modular_integer>::value>::type * = nullptr) noexcept
+		{
+			return x;
+		}
+		template <typename T>
+		static modular_integer to_mi(const T &x, typename std::enable_if<!std::is_same<T,modular_integer>::value>::type * = nullptr)
+		{
+			return modular_integer(x);
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static modular_integer binary_add(const T &x, const U &y)
+		{
+			modular_integer retval(to_mi(x));
+			retval += to_mi(y);
+			return retval;
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static modular_integer binary_sub(const T &x, const U &y)
+		{
+			modular_integer retval(to_mi(x));
+			retval -= to_mi(y);
+			return retval;
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static modular_integer binary_mul(const T &x, const U &y)
+		{
+			modular_integer retval(to_mi(x));
+			retval *= to_mi(y);
+			return retval;
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static modular_integer binary_div(const T &x, const U &y)
+		{
+			modular_integer retval(to_mi(x));
+			retval /= to_mi(y);
+			return retval;
+		}
+		template <typename T, typename U, binary_op_enabler<T,U> = 0>
+		static bool binary_equality(const T &x, const U &y)
+		{
+			return to_mi(x).m_value == to_mi(y).m_value;
+		}
+	public:
+		/// Modulus.
+		static const std::uint_least32_t modulus = P;
+		/// Default constructor.
+		/**
+		 * Will initialise the number to zero.
+		 */
+		modular_integer() noexcept : m_value(0u) {}
+		/// Defaulted copy constructor.
+		modular_integer(const modular_integer &) = default;
+		/// Defaulted move constructor.
+		modular_integer(modular_integer &&) = default;
+		/// Generic constructor.
+		/**
+		 * \note
+		 * This constructor is enabled only if \p T is an \ref interop "interoperable type".
+		 *
+		 * The value of \p n is reduced modulo \p P. Negative values are mapped to their
+		 * non-negative representatives.
+		 *
+		 * @param[in] n object used to construct \p this.
+		 *
+		 * @throws unspecified any exception thrown by the arithmetic operations of piranha::mp_integer.
+		 */
+		template <typename T, typename = generic_ctor_enabler<T>>
+		explicit modular_integer(const T &n):m_value(to_montgomery(reduce(n))) {}
+		/// Defaulted destructor.
+		~modular_integer() = default;
+		/// Defaulted copy-assignment operator.
+		modular_integer &operator=(const modular_integer &) = default;
+		/// Defaulted move-assignment operator.
+		modular_integer &operator=(modular_integer &&) = default;
+		/// Generic assignment operator.
+		/**
+		 * \note
+		 * This assignment operator is enabled only if \p T is an \ref interop "interoperable type".
+		 *
+		 * @param[in] n assignment argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, generic_ctor_enabler<T> = 0>
+		modular_integer &operator=(const T &n)
+		{
+			return (*this = modular_integer(n));
+		}
+		/// Value.
+		/**
+		 * @return the canonical representative of \p this, in the \f$ \left[0,P\right) \f$ range.
+		 */
+		std::uint_least32_t get_value() const noexcept
+		{
+			return redc(m_value);
+		}
+		/// Negate in-place.
+		void negate() noexcept
+		{
+			m_value = mod_sub(0u,m_value);
+		}
+		/// Test for zero.
+		/**
+		 * @return \p true if \p this is zero, \p false otherwise.
+		 */
+		bool is_zero() const noexcept
+		{
+			// NOTE: zero is the only value whose Montgomery form is zero.
+			return m_value == 0u;
+		}
+		/// Multiplicative inverse.
+		/**
+		 * The inverse is computed via Fermat's little theorem.
+		 *
+		 * @return the multiplicative inverse of \p this.
+		 *
+		 * @throws piranha::zero_division_error if \p this is zero.
+		 */
+		modular_integer inverse() const
+		{
+			if (unlikely(is_zero())) {
+				piranha_throw(zero_division_error,"cannot invert zero");
+			}
+			return upow(P - 2u);
+		}
+		/// Exponentiation.
+		/**
+		 * \note
+		 * This method is enabled only if \p T is a C++ integral type or piranha::mp_integer.
+		 *
+		 * Negative exponents are allowed for non-zero values of \p this. The zero-th power of zero is one.
+		 *
+		 * @param[in] n exponent.
+		 *
+		 * @return <tt>this ** n</tt>.
+		 *
+		 * @throws piranha::zero_division_error if \p this is zero and \p n is negative.
+		 * @throws unspecified any exception thrown by the arithmetic operations of piranha::mp_integer.
+		 */
+		template <typename T, typename std::enable_if<is_interoperable_type<T>::value,int>::type = 0>
+		modular_integer pow(const T &n) const
+		{
+			if (is_zero()) {
+				if (unlikely(n < T(0))) {
+					piranha_throw(zero_division_error,"cannot raise zero to a negative power");
+				}
+				return (n == T(0)) ? modular_integer(1) : modular_integer{};
+			}
+			return upow(reduce_exponent(n));
+		}
+		/// In-place addition.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is piranha::modular_integer or an \ref interop "interoperable type".
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		modular_integer &operator+=(const T &x)
+		{
+			m_value = mod_add(m_value,to_mi(x).m_value);
+			return *this;
+		}
+		/// Generic binary addition involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::modular_integer and \p U is an \ref interop "interoperable type",
+		 * - \p U is piranha::modular_integer and \p T is an \ref interop "interoperable type",
+		 * - both \p T and \p U are piranha::modular_integer.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x + y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator+(const T &x, const U &y) -> decltype(modular_integer::binary_add(x,y))
+		{
+			return binary_add(x,y);
+		}
+		/// Identity operator.
+		/**
+		 * @return copy of \p this.
+		 */
+		modular_integer operator+() const noexcept
+		{
+			return *this;
+		}
+		/// In-place subtraction.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is piranha::modular_integer or an \ref interop "interoperable type".
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		modular_integer &operator-=(const T &x)
+		{
+			m_value = mod_sub(m_value,to_mi(x).m_value);
+			return *this;
+		}
+		/// Generic binary subtraction involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::modular_integer and \p U is an \ref interop "interoperable type",
+		 * - \p U is piranha::modular_integer and \p T is an \ref interop "interoperable type",
+		 * - both \p T and \p U are piranha::modular_integer.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x - y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator-(const T &x, const U &y) -> decltype(modular_integer::binary_sub(x,y))
+		{
+			return binary_sub(x,y);
+		}
+		/// Negated copy.
+		/**
+		 * @return copy of \p -this.
+		 */
+		modular_integer operator-() const noexcept
+		{
+			modular_integer retval(*this);
+			retval.negate();
+			return retval;
+		}
+		/// In-place multiplication.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is piranha::modular_integer or an \ref interop "interoperable type".
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		modular_integer &operator*=(const T &x)
+		{
+			m_value = mod_mul(m_value,to_mi(x).m_value);
+			return *this;
+		}
+		/// Generic binary multiplication involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::modular_integer and \p U is an \ref interop "interoperable type",
+		 * - \p U is piranha::modular_integer and \p T is an \ref interop "interoperable type",
+		 * - both \p T and \p U are piranha::modular_integer.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x * y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator*(const T &x, const U &y) -> decltype(modular_integer::binary_mul(x,y))
+		{
+			return binary_mul(x,y);
+		}
+		/// In-place division.
+		/**
+		 * \note
+		 * This operator is enabled only if \p T is piranha::modular_integer or an \ref interop "interoperable type".
+		 *
+		 * @param[in] x argument.
+		 *
+		 * @return reference to \p this.
+		 *
+		 * @throws unspecified any exception thrown by inverse() or by the generic constructor.
+		 */
+		template <typename T, in_place_enabler<T> = 0>
+		modular_integer &operator/=(const T &x)
+		{
+			m_value = mod_mul(m_value,to_mi(x).inverse().m_value);
+			return *this;
+		}
+		/// Generic binary division involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::modular_integer and \p U is an \ref interop "interoperable type",
+		 * - \p U is piranha::modular_integer and \p T is an \ref interop "interoperable type",
+		 * - both \p T and \p U are piranha::modular_integer.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return <tt>x / y</tt>.
+		 *
+		 * @throws unspecified any exception thrown by inverse() or by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator/(const T &x, const U &y) -> decltype(modular_integer::binary_div(x,y))
+		{
+			return binary_div(x,y);
+		}
+		/// Combined multiply-add.
+		/**
+		 * Sets \p this to <tt>this + (x * y)</tt>.
+		 *
+		 * @param[in] x first argument.
+		 * @param[in] y second argument.
+		 *
+		 * @return reference to \p this.
+		 */
+		modular_integer &multiply_accumulate(const modular_integer &x, const modular_integer &y) noexcept
+		{
+			m_value = mod_add(m_value,mod_mul(x.m_value,y.m_value));
+			return *this;
+		}
+		/// Generic equality operator involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if either:
+		 * - \p T is piranha::modular_integer and \p U is an \ref interop "interoperable type",
+		 * - \p U is piranha::modular_integer and \p T is an \ref interop "interoperable type",
+		 * - both \p T and \p U are piranha::modular_integer.
+		 *
+		 * Interoperable types are reduced modulo \p P before the comparison.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x == y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator==(const T &x, const U &y) -> decltype(modular_integer::binary_equality(x,y))
+		{
+			return binary_equality(x,y);
+		}
+		/// Generic inequality operator involving piranha::modular_integer.
+		/**
+		 * \note
+		 * This template operator is enabled only if piranha::modular_integer::operator==() is enabled.
+		 *
+		 * @param[in] x first argument
+		 * @param[in] y second argument.
+		 *
+		 * @return \p true if <tt>x != y</tt>, \p false otherwise.
+		 *
+		 * @throws unspecified any exception thrown by the generic constructor.
+		 */
+		template <typename T, typename U>
+		friend auto operator!=(const T &x, const U &y) -> decltype(!modular_integer::binary_equality(x,y))
+		{
+			return !binary_equality(x,y);
+		}
+		/// Overload output stream operator for piranha::modular_integer.
+		/**
+		 * The canonical representative of \p m (as returned by get_value()) will be printed.
+		 *
+		 * @param[in] os output stream.
+		 * @param[in] m piranha::modular_integer to be directed to stream.
+		 *
+		 * @return reference to \p os.
+		 */
+		friend std::ostream &operator<<(std::ostream &os, const modular_integer &m)
+		{
+			return os << m.get_value();
+		}
+	private:
+		// Value in Montgomery form.
+		std::uint_least32_t m_value;
+};
+
+template <std::uint_least32_t P>
+const std::uint_least32_t modular_integer<P>::modulus;
+
+namespace detail
+{
+
+template <typename T>
+struct is_modular_integer: std::false_type {};
+
+template <std::uint_least32_t P>
+struct is_modular_integer<modular_integer<P>>: std::true_type {};
+
+}
+
+namespace math
+{
+
+/// Specialisation of the piranha::math::negate() functor for piranha::modular_integer.
+template <typename T>
+struct negate_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in,out] x piranha::modular_integer to be negated.
+	 */
+	void operator()(T &x) const noexcept
+	{
+		x.negate();
+	}
+};
+
+/// Specialisation of the piranha::math::is_zero() functor for piranha::modular_integer.
+template <typename T>
+struct is_zero_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x piranha::modular_integer to be tested.
+	 *
+	 * @return \p true if \p x is zero, \p false otherwise.
+	 */
+	bool operator()(const T &x) const noexcept
+	{
+		return x.is_zero();
+	}
+};
+
+/// Specialisation of the piranha::math::pow() functor for piranha::modular_integer.
+/**
+ * This specialisation is activated when \p T is piranha::modular_integer and \p U is a C++ integral
+ * type or piranha::mp_integer.
+ */
+template <typename T, typename U>
+struct pow_impl<T,U,typename std::enable_if<detail::is_modular_integer<T>::value &&
+	detail::is_modular_integer_interoperable_type<U>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x base.
+	 * @param[in] n exponent.
+	 *
+	 * @return \p x to the power of \p n.
+	 *
+	 * @throws unspecified any exception thrown by piranha::modular_integer::pow().
+	 */
+	T operator()(const T &x, const U &n) const
+	{
+		return x.pow(n);
+	}
+};
+
+/// Specialisation of the piranha::math::partial() functor for piranha::modular_integer.
+template <typename T>
+struct partial_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @return an instance of piranha::modular_integer constructed from zero.
+	 */
+	T operator()(const T &, const std::string &) const noexcept
+	{
+		return T{};
+	}
+};
+
+/// Specialisation of the piranha::math::evaluate() functor for piranha::modular_integer.
+template <typename T>
+struct evaluate_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x evaluation argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::unordered_map<std::string,U> &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the piranha::math::subs() functor for piranha::modular_integer.
+template <typename T>
+struct subs_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x substitution argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::string &, const U &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the piranha::math::ipow_subs() functor for piranha::modular_integer.
+/**
+ * This specialisation is activated when \p T is piranha::modular_integer.
+ * The result will be the input value unchanged.
+ */
+template <typename T>
+struct ipow_subs_impl<T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * @param[in] x substitution argument.
+	 *
+	 * @return copy of \p x.
+	 */
+	template <typename U>
+	T operator()(const T &x, const std::string &, const integer &, const U &) const
+	{
+		return x;
+	}
+};
+
+/// Specialisation of the implementation of piranha::math::multiply_accumulate() for piranha::modular_integer.
+template <typename T>
+struct multiply_accumulate_impl<T,T,T,typename std::enable_if<detail::is_modular_integer<T>::value>::type>
+{
+	/// Call operator.
+	/**
+	 * This implementation will use piranha::modular_integer::multiply_accumulate().
+	 *
+	 * @param[in,out] x target value for accumulation.
+	 * @param[in] y first argument.
+	 * @param[in] z second argument.
+	 *
+	 * @return <tt>x.multiply_accumulate(y,z)</tt>.
+	 */
+	auto operator()(T &x, const T &y, const T &z) const noexcept -> decltype(x.multiply_accumulate(y,z))
+	{
+		return x.multiply_accumulate(y,z);
+	}
+};
+
+}
+
+// NOTE: as in double_double, the static checks live here rather than in the destructor in order to keep
+// modular_integer trivially copyable and destructible.
+PIRANHA_TT_CHECK(is_cf,modular_integer<2147483647ul>);
+
+}
+
+#endif
@@ -37,6 +37,7 @@
 #include "array_key.hpp"
 #include "detail/degree_commons.hpp"
 #include "detail/prepare_for_print.hpp"
+#include "detail/vector_kernels.hpp"
 #include "config.hpp"
 #include "forwarding.hpp"
 #include "math.hpp"
@@ -142,6 +143,37 @@ class monomial: public array_key<T,monomial<T,S>,S>
 				x = static_cast<U>(x - y);
 			}
 		};
+		// Implementation of multiply(): integral exponents are added via the checked kernel
+		// operating on the whole exponent buffers, other types go through array_key::add().
+		void multiply_impl(monomial &retval, const monomial &other, const std::false_type &) const
+		{
+			this->add(retval,other);
+		}
+		void multiply_impl(monomial &retval, const monomial &other, const std::true_type &) const
+		{
+			const auto size = this->size();
+			if (unlikely(other.size() != size)) {
+				piranha_throw(std::invalid_argument,"vector size mismatch");
+			}
+			retval.resize(size);
+			if (unlikely(!detail::vector_add_checked(retval.begin(),this->begin(),other.begin(),
+				static_cast<std::size_t>(size))))
+			{
+				piranha_throw(std::overflow_error,"overflow in the multiplication of two monomials");
+			}
+		}
+		// Total degree.
+		typename base::value_type degree_impl(const symbol_set &args, const std::false_type &) const
+		{
+			return detail::monomial_degree<typename base::value_type>(*this,in_place_adder<typename base::value_type>(),args);
+		}
+		typename base::value_type degree_impl(const symbol_set &args, const std::true_type &) const
+		{
+			if (unlikely(args.size() != this->size())) {
+				piranha_throw(std::invalid_argument,"invalid arguments set");
+			}
+			return detail::vector_sum(this->begin(),static_cast<std::size_t>(this->size()));
+		}
 	public:
 		/// Defaulted default constructor.
 		monomial() = default;
@@ -234,7 +266,8 @@ class monomial: public array_key<T,monomial<T,S>,S>
 		}
 		/// Degree.
 		/**
-		 * Degree of the monomial.
+		 * Degree of the monomial. If the exponent type is a C++ integral type, the summation is performed
+		 * in a single pass over the exponent buffer with modular arithmetic.
 		 * 
 		 * @param[in] args reference set of piranha::symbol.
 		 * 
@@ -246,7 +279,7 @@ class monomial: public array_key<T,monomial<T,S>,S>
 		 */
 		typename base::value_type degree(const symbol_set &args) const
 		{
-			return detail::monomial_degree<typename base::value_type>(*this,in_place_adder<typename base::value_type>(),args);
+			return degree_impl(args,detail::vk_enabled<typename base::value_type>());
 		}
 		/// Low degree.
 		/**
@@ -295,6 +328,39 @@ class monomial: public array_key<T,monomial<T,S>,S>
 		{
 			return degree(active_args,args);
 		}
+		/// Partial degree from positions.
+		/**
+		 * Equivalent to the partial degree, but the symbols to be considered are identified by their positions
+		 * in \p args.
+		 * 
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 * 
+		 * @return the summation of all the exponents of the monomial corresponding to the positions in \p p.
+		 * 
+		 * @throws std::invalid_argument if the sizes of \p args and \p this differ, or if the positions in \p p
+		 * are not compatible with \p args.
+		 * @throws unspecified any exception thrown by the constructor and the addition and assignment operators of \p value_type.
+		 */
+		typename base::value_type degree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			return detail::monomial_partial_degree<typename base::value_type>(*this,in_place_adder<typename base::value_type>(),p,args);
+		}
+		/// Partial low degree from positions.
+		/**
+		 * Analogous to the partial degree from positions.
+		 * 
+		 * @param[in] p positions of the symbols that will be considered in the computation of the partial low degree of the monomial.
+		 * @param[in] args reference set of piranha::symbol.
+		 * 
+		 * @return the output of degree().
+		 * 
+		 * @throws unspecified any exception thrown by degree().
+		 */
+		typename base::value_type ldegree(const symbol_set::positions &p, const symbol_set &args) const
+		{
+			return degree(p,args);
+		}
 		/// Multiply monomial.
 		/**
 		 * \note
@@ -303,13 +369,17 @@ class monomial: public array_key<T,monomial<T,S>,S>
 		 *
 		 * Multiplies \p this by \p other and stores the result in \p retval. The exception safety
 		 * guarantee is the same as for piranha::array_key::add().
+		 *
+		 * If the exponent type is a C++ integral type, the exponents are added with overflow detection
+		 * in a single pass over the exponent buffers.
 		 * 
 		 * @param[out] retval return value.
 		 * @param[in] other argument of multiplication.
 		 * @param[in] args reference set of arguments.
 		 * 
 		 * @throws std::invalid_argument if the sizes of \p args and \p this differ.
-		 * @throws unspecified any exception thrown by piranha::array_key::add().
+		 * @throws std::overflow_error if the exponent type is integral and the addition of two exponents overflows.
+		 * @throws unspecified any exception thrown by piranha::array_key::add() or piranha::array_key::resize().
 		 *
 		 * @return the return value of piranha::array_key::add().
 		 */
@@ -320,7 +390,7 @@ class monomial: public array_key<T,monomial<T,S>,S>
 			if(unlikely(other.size() != args.size())) {
 				piranha_throw(std::invalid_argument,"invalid size of arguments set");
 			}
-			this->add(retval,other);
+			multiply_impl(retval,other,detail::vk_enabled<typename base::value_type>());
 		}
 		/// Name of the linear argument.
 		/**
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <boost/functional/hash.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <climits>
@@ -33,6 +34,7 @@
 #include <gmp.h>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -43,11 +45,13 @@
 #include "config.hpp"
 #include "debug_access.hpp"
 #include "detail/is_digit.hpp"
+#include "detail/mp_integer_fwd.hpp"
 #include "detail/mp_rational_fwd.hpp"
 #include "detail/real_fwd.hpp"
 #include "detail/sfinae_types.hpp"
 #include "exceptions.hpp"
 #include "math.hpp"
+#include "tracing.hpp"
 #include "type_traits.hpp"
 
 namespace piranha { namespace detail {
@@ -239,6 +243,109 @@ inline std::ostream &stream_mpz(std::ostream &os, const mpz_struct_t &mpz)
 	return os;
 }
 
+// Append the decimal representation of mpz to out, writing directly into the string's storage.
+inline void append_mpz_decimal(std::string &out, const mpz_struct_t &mpz)
+{
+	const std::size_t size_base10 = ::mpz_sizeinbase(&mpz,10);
+	const auto old_size = out.size();
+	if (unlikely(size_base10 > out.max_size() - 2u || old_size > out.max_size() - 2u - size_base10)) {
+		piranha_throw(std::invalid_argument,"number of digits is too large");
+	}
+	out.resize(old_size + size_base10 + 2u);
+	::mpz_get_str(&out[old_size],10,&mpz);
+	// NOTE: mpz_sizeinbase() might overestimate the number of digits by one.
+	out.resize(old_size + std::char_traits<char>::length(&out[old_size]));
+}
+
+// Write the decimal digits of the unsigned integer n backwards, ending at ptr. Returns a pointer
+// to the most significant digit.
+template <typename T>
+inline char *write_decimal_digits(char *ptr, const T &n, typename std::enable_if<(sizeof(T) <= sizeof(unsigned long long))>::type * = nullptr)
+{
+	auto m = static_cast<unsigned long long>(n);
+	do {
+		*--ptr = static_cast<char>('0' + m % 10u);
+		m /= 10u;
+	} while (m);
+	return ptr;
+}
+
+// NOTE: for double-width types (e.g., 128-bit integers) we peel off chunks of 19 digits with wide
+// divisions, and then finish with native arithmetic. This avoids a wide division for every digit.
+template <typename T>
+inline char *write_decimal_digits(char *ptr, T n, typename std::enable_if<(sizeof(T) > sizeof(unsigned long long))>::type * = nullptr)
+{
+	const unsigned long long chunk = 10000000000000000000ull;
+	while (n >> std::numeric_limits<unsigned long long>::digits) {
+		auto r = static_cast<unsigned long long>(n % chunk);
+		n = static_cast<T>(n / chunk);
+		for (int i = 0; i < 19; ++i) {
+			*--ptr = static_cast<char>('0' + r % 10u);
+			r /= 10u;
+		}
+	}
+	return write_decimal_digits(ptr,static_cast<unsigned long long>(n));
+}
+
+// Variable-length encoding of unsigned integers: 7 bits per byte, least significant group first,
+// with the high bit set on all bytes but the last one.
+inline void append_varint(std::string &out, unsigned long long n)
+{
+	while (n >= 0x80u) {
+		out.push_back(static_cast<char>((n & 0x7Fu) | 0x80u));
+		n >>= 7u;
+	}
+	out.push_back(static_cast<char>(n));
+}
+
+inline unsigned long long read_varint(const char *&begin, const char *end)
+{
+	unsigned long long retval = 0u;
+	for (unsigned shift = 0u; ; shift += 7u) {
+		if (unlikely(begin == end || shift >= unsigned(std::numeric_limits<unsigned long long>::digits))) {
+			piranha_throw(std::invalid_argument,"invalid binary encoding");
+		}
+		const auto byte = static_cast<unsigned char>(*begin++);
+		retval |= static_cast<unsigned long long>(byte & 0x7Fu) << shift;
+		if (!(byte & 0x80u)) {
+			return retval;
+		}
+	}
+}
+
+// Binary encoding of integers: a varint header storing the number of bytes of the absolute value
+// (shifted left by one) and the sign (in the lowest bit), followed by the bytes of the absolute value,
+// least significant first.
+inline void append_mpz_binary(std::string &out, const mpz_struct_t &mpz)
+{
+	const std::size_t n_bytes = (mpz_sgn(&mpz) == 0) ? 0u : (::mpz_sizeinbase(&mpz,2) + 7u) / 8u;
+	if (unlikely(n_bytes > std::numeric_limits<unsigned long long>::max() / 2u)) {
+		piranha_throw(std::invalid_argument,"number of bytes is too large");
+	}
+	append_varint(out,(static_cast<unsigned long long>(n_bytes) << 1u) | static_cast<unsigned long long>(mpz_sgn(&mpz) < 0));
+	const auto old_size = out.size();
+	out.resize(old_size + n_bytes);
+	if (n_bytes) {
+		std::size_t count;
+		::mpz_export(&out[old_size],&count,-1,1u,0,0u,&mpz);
+		piranha_assert(count == n_bytes);
+	}
+}
+
+inline void read_mpz_binary(mpz_struct_t &mpz, const char *&begin, const char *end)
+{
+	const auto header = read_varint(begin,end);
+	const auto n_bytes = header >> 1u;
+	if (unlikely(n_bytes > static_cast<unsigned long long>(end - begin))) {
+		piranha_throw(std::invalid_argument,"invalid binary encoding");
+	}
+	::mpz_import(&mpz,static_cast<std::size_t>(n_bytes),-1,1u,0,0u,begin);
+	if (header & 1u) {
+		::mpz_neg(&mpz,&mpz);
+	}
+	begin += n_bytes;
+}
+
 template <int NBits>
 struct static_integer
 {
@@ -343,6 +450,35 @@ struct static_integer
 	{
 		return static_cast<mpz_size_t>((_mp_size >= 0) ? _mp_size : -_mp_size);
 	}
+	// Absolute value and sign, packed into a double limb. This is exact, as the double limb type is wide enough
+	// to contain two limbs.
+	dlimb_t abs_value() const
+	{
+		return static_cast<dlimb_t>(static_cast<dlimb_t>(m_limbs[0u]) + static_cast<dlimb_t>(static_cast<dlimb_t>(m_limbs[1u]) << limb_bits));
+	}
+	void set_abs_value(const dlimb_t &n, bool negative)
+	{
+		m_limbs[0u] = static_cast<limb_t>(n & static_cast<dlimb_t>((dlimb_t(1) << limb_bits) - 1u));
+		m_limbs[1u] = static_cast<limb_t>(n >> limb_bits);
+		_mp_size = calculate_n_limbs();
+		if (negative) {
+			negate();
+		}
+		piranha_assert(consistency_checks());
+	}
+	// Number of decimal digits that are guaranteed to fit in the static storage: floor(log10(2) * 2 * limb_bits).
+	static const std::size_t safe_decimal_digits = static_cast<std::size_t>(2u * limb_bits * 30103ul / 100000ul);
+	// Maximum number of decimal characters (including the sign) needed to print a static integer.
+	static const std::size_t max_decimal_size = safe_decimal_digits + 3u;
+	// Write the decimal representation backwards, ending at ptr.
+	char *write_decimal(char *ptr) const
+	{
+		ptr = write_decimal_digits(ptr,abs_value());
+		if (_mp_size < 0) {
+			*--ptr = '-';
+		}
+		return ptr;
+	}
 	// Read-only mpz view class. After creation, this class can be used
 	// as const mpz_t argument in GMP functions, thanks to the implicit conversion
 	// operator.
@@ -449,8 +585,10 @@ struct static_integer
 	}
 	friend std::ostream &operator<<(std::ostream &os, const static_integer &si)
 	{
-		auto v = si.get_mpz_view();
-		return stream_mpz(os,*static_cast<const mpz_struct_t *>(v));
+		// NOTE: the decimal conversion is done with native arithmetic, without going through GMP.
+		char buffer[max_decimal_size + 1u];
+		buffer[max_decimal_size] = '\0';
+		return (os << si.write_decimal(buffer + max_decimal_size));
 	}
 	bool operator==(const static_integer &other) const
 	{
@@ -860,6 +998,12 @@ struct static_integer
 template <int NBits>
 const typename static_integer<NBits>::limb_t static_integer<NBits>::limb_bits;
 
+template <int NBits>
+const std::size_t static_integer<NBits>::safe_decimal_digits;
+
+template <int NBits>
+const std::size_t static_integer<NBits>::max_decimal_size;
+
 // Integer union.
 template <int NBits>
 union integer_union
@@ -1093,6 +1237,14 @@ struct is_mp_integer_interoperable_type
  * - when converting to/from Python we can speed up operations by trying casting around to hardware integers, if range is enough.
  * - use a unified shortcut for the possible optimisation when the two limb type coincide (e.g., same_limbs_type = true constexpr).
  */
+namespace detail
+{
+
+template <int>
+struct binomial_cache;
+
+}
+
 template <int NBits = 0>
 class mp_integer
 {
@@ -1240,13 +1392,35 @@ class mp_integer
 				}
 			});
 		}
+		// Fast construction from a validated string, if the number of digits is small enough to ensure the
+		// value fits in static storage. Returns false if the number is too long.
+		bool construct_from_short_string(const char *str, std::size_t size)
+		{
+			using s_storage = typename detail::integer_union<NBits>::s_storage;
+			using dlimb_t = typename s_storage::dlimb_t;
+			const bool negative = (str[0] == '-');
+			if (size - static_cast<std::size_t>(negative) > s_storage::safe_decimal_digits) {
+				return false;
+			}
+			dlimb_t n(0u);
+			for (std::size_t i = static_cast<std::size_t>(negative); i < size; ++i) {
+				n = static_cast<dlimb_t>(n * 10u + static_cast<dlimb_t>(str[i] - '0'));
+			}
+			piranha_assert(m_int.is_static());
+			m_int.g_st().set_abs_value(n,negative);
+			return true;
+		}
 		void construct_from_string(const char *str)
 		{
 			// NOTE: it seems to be ok to call strlen on a char pointer obtained from std::string::c_str()
 			// (as we do in the constructor from std::string). The output of c_str() is guaranteed
 			// to be NULL terminated, and if the string is empty, this will still work (21.4.7 and around).
-			validate_string(str,std::strlen(str));
+			const auto size = std::strlen(str);
+			validate_string(str,size);
 			// String is OK.
+			if (construct_from_short_string(str,size)) {
+				return;
+			}
 			detail::mpz_raii m;
 			// Use set() as m is already inited.
 			const int retval = ::mpz_set_str(&m.m_mpz,str,10);
@@ -2082,6 +2256,123 @@ class mp_integer
 		{
 			return convert_to_impl<T>();
 		}
+		/// Append the decimal representation to a string.
+		/**
+		 * The decimal representation of \p this (the same produced by the stream operator) will be appended
+		 * to \p out. This method is intended for the conversion of many values in bulk: by reusing the same output
+		 * string no memory allocation is needed in the common case, and values stored in static storage are converted
+		 * with native arithmetic, without going through GMP.
+		 *
+		 * @param[in,out] out output string.
+		 *
+		 * @throws std::invalid_argument if the number of digits is larger than an implementation-defined maximum.
+		 * @throws unspecified any exception thrown by memory allocation errors in \p std::string.
+		 */
+		void to_decimal(std::string &out) const
+		{
+			if (m_int.is_static()) {
+				using s_storage = typename detail::integer_union<NBits>::s_storage;
+				char buffer[s_storage::max_decimal_size];
+				char *const end = buffer + s_storage::max_decimal_size;
+				out.append(m_int.g_st().write_decimal(end),end);
+			} else {
+				detail::append_mpz_decimal(out,m_int.g_dy());
+			}
+		}
+		/// Construct from a range of decimal characters.
+		/**
+		 * This static method is the counterpart of to_decimal(): it will parse the characters in the range
+		 * [\p begin, \p end), which must follow the same format required by the constructor from string, and which
+		 * need not be null-terminated. Numbers with a few digits are parsed directly into static storage.
+		 *
+		 * @param[in] begin start of the range.
+		 * @param[in] end end of the range.
+		 *
+		 * @return the integer represented by the characters in the range.
+		 *
+		 * @throws std::invalid_argument if the range does not represent a valid integer.
+		 * @throws unspecified any exception thrown by the constructor from string.
+		 */
+		static mp_integer from_decimal(const char *begin, const char *end)
+		{
+			piranha_assert(begin <= end);
+			const auto size = static_cast<std::size_t>(end - begin);
+			validate_string(begin,size);
+			mp_integer retval;
+			if (retval.construct_from_short_string(begin,size)) {
+				return retval;
+			}
+			return mp_integer(std::string(begin,end));
+		}
+		/// Append the binary representation to a string.
+		/**
+		 * A compact binary representation of \p this will be appended to \p out. The representation consists of
+		 * a variable-length header, encoding the sign and the number of bytes of the absolute value, followed by the bytes
+		 * of the absolute value (from the least significant). The format does not depend on the endianness of the
+		 * platform, nor on the limb size of GMP or of \p this. Small values take only a few bytes, and they are encoded
+		 * without going through GMP.
+		 *
+		 * @param[in,out] out output string.
+		 *
+		 * @throws std::invalid_argument if the number of bytes is larger than an implementation-defined maximum.
+		 * @throws unspecified any exception thrown by memory allocation errors in \p std::string.
+		 */
+		void to_binary(std::string &out) const
+		{
+			if (!m_int.is_static()) {
+				detail::append_mpz_binary(out,m_int.g_dy());
+				return;
+			}
+			using dlimb_t = typename detail::integer_union<NBits>::s_storage::dlimb_t;
+			const dlimb_t n = m_int.g_st().abs_value();
+			unsigned long long n_bytes = 0u;
+			for (dlimb_t tmp = n; tmp; tmp = static_cast<dlimb_t>(tmp >> 8u)) {
+				++n_bytes;
+			}
+			detail::append_varint(out,(n_bytes << 1u) | static_cast<unsigned long long>(m_int.g_st()._mp_size < 0));
+			for (unsigned long long i = 0u; i < n_bytes; ++i) {
+				out.push_back(static_cast<char>(static_cast<unsigned char>((n >> (8u * i)) & 0xFFu)));
+			}
+		}
+		/// Read the binary representation from a range of characters.
+		/**
+		 * This static method is the counterpart of to_binary(): it will decode the value whose binary representation
+		 * starts at \p begin, and advance \p begin past the end of the representation. Sequences of values can thus be decoded
+		 * by calling this method repeatedly on the same range.
+		 *
+		 * @param[in,out] begin start of the range.
+		 * @param[in] end end of the range.
+		 *
+		 * @return the decoded integer.
+		 *
+		 * @throws std::invalid_argument if the range does not contain a valid binary representation.
+		 */
+		static mp_integer from_binary(const char *&begin, const char *end)
+		{
+			using s_storage = typename detail::integer_union<NBits>::s_storage;
+			using dlimb_t = typename s_storage::dlimb_t;
+			mp_integer retval;
+			const char *ptr = begin;
+			const auto header = detail::read_varint(ptr,end);
+			const auto n_bytes = header >> 1u;
+			if (n_bytes <= 2u * s_storage::limb_bits / 8u) {
+				if (unlikely(n_bytes > static_cast<unsigned long long>(end - ptr))) {
+					piranha_throw(std::invalid_argument,"invalid binary encoding");
+				}
+				dlimb_t n(0u);
+				for (unsigned long long i = 0u; i < n_bytes; ++i) {
+					n = static_cast<dlimb_t>(n | static_cast<dlimb_t>(static_cast<dlimb_t>(static_cast<unsigned char>(ptr[i])) << (8u * i)));
+				}
+				retval.m_int.g_st().set_abs_value(n,(header & 1u) != 0u);
+				begin = ptr + n_bytes;
+			} else {
+				detail::mpz_raii m;
+				detail::read_mpz_binary(m.m_mpz,begin,end);
+				retval.m_int.promote();
+				::mpz_swap(&m.m_mpz,&retval.m_int.g_dy());
+			}
+			return retval;
+		}
 		/// Overload output stream operator for piranha::mp_integer.
 		/**
 		 * The input \p n will be directed to the output stream \p os as a string of digits in base 10.
@@ -2947,19 +3238,24 @@ class mp_integer
 		}
 		/// Factorial.
 		/**
-		 * The GMP function <tt>mpz_fac_ui()</tt> will be used.
+		 * Small factorials are fetched from a thread-safe cache of exact values, which is grown on demand.
+		 * Otherwise, the GMP function <tt>mpz_fac_ui()</tt> will be used.
 		 *
 		 * @return the factorial of \p this.
 		 *
 		 * @throws std::invalid_argument if \p this is negative or larger than an implementation-defined value.
+		 * @throws unspecified any exception thrown by threading primitives or by memory allocation errors.
 		 */
 		mp_integer factorial() const
 		{
 			if (*this > 100000L || sign() < 0) {
 				piranha_throw(std::invalid_argument,"invalid input for factorial()");
 			}
-			// NOTE: demote opportunity.
 			mp_integer retval;
+			if (detail::binomial_cache<NBits>::factorial(retval,static_cast<unsigned long>(*this))) {
+				return retval;
+			}
+			// NOTE: demote opportunity.
 			retval.promote();
 			::mpz_fac_ui(&retval.m_int.g_dy(),static_cast<unsigned long>(*this));
 			return retval;
@@ -2991,25 +3287,36 @@ class mp_integer
 		 * \note
 		 * This method is enabled only if \p T is an integral type or piranha::mp_integer.
 		 *
-		 * Will return \p this choose \p k using the GMP <tt>mpz_bin_ui</tt> function.
+		 * Will return \p this choose \p k. If \p this is small and non-negative, the value will be fetched from a thread-safe
+		 * cache of rows of the Pascal triangle, which is grown on demand. Otherwise, the GMP <tt>mpz_bin_ui</tt> function will be used.
 		 *
 		 * @param[in] k bottom argument for the binomial coefficient.
 		 *
 		 * @return \p this choose \p k.
 		 *
 		 * @throws std::invalid_argument if \p k is outside an implementation-defined range.
+		 * @throws unspecified any exception thrown by threading primitives or by memory allocation errors.
 		 */
 		template <typename T, typename std::enable_if<std::is_integral<T>::value ||
 			std::is_same<mp_integer,T>::value,int>::type = 0>
 		mp_integer binomial(const T &k) const
 		{
 			if (k >= T(0)) {
+				const unsigned long uk = check_choose_k(k);
+				if (sign() >= 0 && *this <= detail::binomial_cache<NBits>::max_binomial) {
+					mp_integer retval;
+					if (*this < uk) {
+						return retval;
+					}
+					detail::binomial_cache<NBits>::binomial(retval,static_cast<unsigned>(*this),static_cast<unsigned>(uk));
+					return retval;
+				}
 				mp_integer retval(*this);
 				if (is_static()) {
 					retval.promote();
 				}
 				// NOTE: demote opportunity.
-				::mpz_bin_ui(&retval.m_int.g_dy(),&retval.m_int.g_dy(),check_choose_k(k));
+				::mpz_bin_ui(&retval.m_int.g_dy(),&retval.m_int.g_dy(),uk);
 				return retval;
 			} else {
 				// This is the case k < 0, handled according to:
@@ -3037,6 +3344,110 @@ using integer = mp_integer<>;
 namespace detail
 {
 
+// Thread-safe cache of exact factorials and rows of the Pascal triangle for small non-negative arguments.
+// The tables are grown on demand up to fixed maximum sizes. Lookups are lock-free: the entries are computed
+// under a mutex, and the number of valid entries is published via an atomic counter afterwards. Published
+// entries are never modified.
+template <int NBits>
+struct binomial_cache
+{
+	using int_type = mp_integer<NBits>;
+	// Maximum argument of the cached factorials.
+	static const unsigned max_factorial = 1000u;
+	// Maximum top argument of the cached binomial coefficients.
+	static const unsigned max_binomial = 200u;
+	static int_type *factorial_table()
+	{
+		static int_type table[max_factorial + 1u];
+		return table;
+	}
+	static int_type *binomial_table()
+	{
+		static int_type table[(max_binomial + 1u) * (max_binomial + 2u) / 2u];
+		return table;
+	}
+	static void trace_lookup(bool hit)
+	{
+		tracing::trace(hit ? "binomial_cache_hits" : "binomial_cache_misses",[](boost::any &x) {
+			if (unlikely(x.empty())) {
+				x = 0ull;
+			}
+			auto ptr = boost::any_cast<unsigned long long>(&x);
+			if (likely((bool)ptr)) {
+				++*ptr;
+			}
+		});
+	}
+	// Store n! in out. Returns false if n is outside the range of the cache.
+	static bool factorial(int_type &out, unsigned long n)
+	{
+		if (n > max_factorial) {
+			return false;
+		}
+		int_type *table = factorial_table();
+		if (n < s_n_factorials.load(std::memory_order_acquire)) {
+			trace_lookup(true);
+		} else {
+			trace_lookup(false);
+			std::lock_guard<std::mutex> lock(s_mutex);
+			auto size = s_n_factorials.load(std::memory_order_relaxed);
+			for (; size <= n; ++size) {
+				table[size] = size ? table[size - 1u] * size : int_type(1);
+			}
+			s_n_factorials.store(size,std::memory_order_release);
+		}
+		out = table[n];
+		return true;
+	}
+	// Store n choose k in out. Requires k <= n <= max_binomial.
+	static void binomial(int_type &out, unsigned n, unsigned k)
+	{
+		piranha_assert(k <= n && n <= max_binomial);
+		int_type *table = binomial_table();
+		if (n < s_n_rows.load(std::memory_order_acquire)) {
+			trace_lookup(true);
+		} else {
+			trace_lookup(false);
+			std::lock_guard<std::mutex> lock(s_mutex);
+			auto size = s_n_rows.load(std::memory_order_relaxed);
+			for (; size <= n; ++size) {
+				// Rows are stored contiguously, row i starting at index i * (i + 1) / 2.
+				int_type *row = table + size * (size + 1u) / 2u, *prev = row - size;
+				row[0u] = 1;
+				for (unsigned i = 1u; i < size; ++i) {
+					row[i] = prev[i - 1u] + prev[i];
+				}
+				row[size] = 1;
+			}
+			s_n_rows.store(size,std::memory_order_release);
+		}
+		out = table[n * (n + 1u) / 2u + k];
+	}
+	static std::mutex		s_mutex;
+	static std::atomic<unsigned long>	s_n_factorials;
+	static std::atomic<unsigned>	s_n_rows;
+};
+
+template <int NBits>
+const unsigned binomial_cache<NBits>::max_factorial;
+
+template <int NBits>
+const unsigned binomial_cache<NBits>::max_binomial;
+
+template <int NBits>
+std::mutex binomial_cache<NBits>::s_mutex;
+
+template <int NBits>
+std::atomic<unsigned long> binomial_cache<NBits>::s_n_factorials(0ul);
+
+template <int NBits>
+std::atomic<unsigned> binomial_cache<NBits>::s_n_rows(0u);
+
+}
+
+namespace detail
+{
+
 // Temporary TMP structure to detect mp_integer types.
 // Should be replaced by is_instance_of once (or if) we move
 // from NBits to an integral_constant for selecting limb
@@ -1530,8 +1530,8 @@ class mp_rational
 		 *
 		 * @return \p this choose \p n.
 		 *
-		 * @throws unspecified any exception thrown by piranha::mp_integer::binomial()
-		 * or by arithmetic operations on piranha::mp_rational.
+		 * @throws unspecified any exception thrown by piranha::mp_integer::binomial(), piranha::mp_integer::factorial()
+		 * or by arithmetic operations on piranha::mp_rational and piranha::mp_integer.
 		 */
 		template <typename T, typename std::enable_if<std::is_integral<T>::value ||
 			std::is_same<T,int_type>::value,int>::type = 0>
@@ -1545,10 +1545,21 @@ class mp_rational
 				// (rational negative-int) will always give zero.
 				return mp_rational{};
 			}
-			// (rational non-negative-int) uses the generic implementation.
-			// NOTE: this is going to be really slow, it can be improved by orders
-			// of magnitude.
-			return detail::generic_binomial(*this,n);
+			const int_type k(n);
+			if (unlikely(k > 100000L)) {
+				// (rational non-negative-int) for large k uses the generic implementation.
+				return detail::generic_binomial(*this,n);
+			}
+			// (rational non-negative-int): with x = a / b, the falling factorial of x is
+			// a * (a - b) * ... * (a - (k - 1) * b) / b**k, and the result is obtained dividing by k!
+			// (which is fetched from the cache for small k). A single canonicalisation is performed at the end.
+			const auto uk = static_cast<unsigned long>(k);
+			int_type num(1), tmp(m_num);
+			for (unsigned long i = 0u; i < uk; ++i) {
+				num *= tmp;
+				tmp -= m_den;
+			}
+			return mp_rational{num,m_den.pow(uk) * k.factorial()};
 		}
 	private:
 		int_type	m_num;
@@ -138,15 +138,18 @@ inline namespace literals {}
 #include "config.hpp"
 #include "convert_to.hpp"
 #include "debug_access.hpp"
+#include "double_double.hpp"
 #include "dynamic_aligning_allocator.hpp"
 #include "echelon_size.hpp"
 #include "environment.hpp"
 #include "exceptions.hpp"
+#include "fixed_monomial.hpp"
 #include "hash_set.hpp"
 #include "kronecker_array.hpp"
 #include "kronecker_monomial.hpp"
 #include "math.hpp"
 #include "memory.hpp"
+#include "modular_integer.hpp"
 #include "monomial.hpp"
 #include "mp_integer.hpp"
 #include "mp_rational.hpp"
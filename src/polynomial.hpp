@@ -22,12 +22,14 @@
 #define PIRANHA_POLYNOMIAL_HPP
 
 #include <algorithm>
+#include <array>
 #include <boost/integer_traits.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <cmath> // For std::ceil.
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <functional> // For std::bind.
 #include <initializer_list>
 #include <iterator>
@@ -40,11 +42,13 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "config.hpp"
 #include "debug_access.hpp"
+#include "detail/kronecker_int.hpp"
 #include "detail/poisson_series_fwd.hpp"
 #include "detail/polynomial_fwd.hpp"
 #include "echelon_size.hpp"
@@ -53,11 +57,13 @@
 #include "kronecker_array.hpp"
 #include "kronecker_monomial.hpp"
 #include "math.hpp"
+#include "modular_integer.hpp"
 #include "mp_integer.hpp"
 #include "polynomial_term.hpp"
 #include "power_series.hpp"
 #include "series.hpp"
 #include "series_multiplier.hpp"
+#include "settings.hpp"
 #include "symbol.hpp"
 #include "symbol_set.hpp"
 #include "t_substitutable_series.hpp"
@@ -180,6 +186,195 @@ class polynomial:
 				std::declval<key_type>().ipow_subs(std::declval<symbol>(),std::declval<integer>(),std::declval<T>(),std::declval<symbol_set>()).first
 			) type;
 		};
+		// Grouped substitution engine. The terms are grouped according to the exponent of the substituted symbol: the
+		// power of the substituted quantity is then computed once per group (via the substitution method of the first
+		// key in the group), the group is assembled in a single series with the substituted coefficients and the
+		// reduced keys, and finally multiplied by the power. This replaces the per-term construction and multiplication of
+		// one-term series. The engine is enabled if the substitution of the coefficients does not change their type,
+		// the exponents can be ordered, and multiplying a polynomial by the power yields the return type.
+		template <typename T, typename CfSub, typename KeySub, typename = void>
+		struct grouped_subs_enabler
+		{
+			static const bool value = false;
+		};
+		template <typename T, typename CfSub, typename KeySub>
+		struct grouped_subs_enabler<T,CfSub,KeySub,typename std::enable_if<
+			std::is_same<typename std::decay<CfSub>::type,typename base::term_type::cf_type>::value &&
+			is_less_than_comparable<typename std::decay<decltype(std::declval<const typename base::term_type::key_type &>().degree(
+			std::declval<const symbol_set::positions &>(),std::declval<const symbol_set &>()))>::type>::value &&
+			std::is_same<decltype(std::declval<const polynomial &>() * std::declval<const typename KeySub::first_type &>()),T>::value
+			>::type>
+		{
+			static const bool value = true;
+		};
+		// PowF computes, from the first key of a group, the power of the substituted quantity and the data needed
+		// by KeyF to reduce the keys of the group. CfF substitutes the coefficients.
+		template <typename RetT, typename PowF, typename CfF, typename KeyF>
+		RetT grouped_subs(const symbol &s, const symbol_set &new_ss, const PowF &pow_f, const CfF &cf_f, const KeyF &key_f) const
+		{
+			typedef typename base::term_type term_type;
+			typedef typename term_type::key_type key_type;
+			typedef typename std::decay<decltype(std::declval<const key_type &>().degree(std::declval<const symbol_set::positions &>(),
+				std::declval<const symbol_set &>()))>::type degree_type;
+			typedef std::vector<const term_type *> group_type;
+			const symbol_set::positions p(this->m_symbol_set,std::set<std::string>{s.get_name()});
+			std::map<degree_type,group_type> groups;
+			const auto it_f = this->m_container.end();
+			for (auto it = this->m_container.begin(); it != it_f; ++it) {
+				groups[it->m_key.degree(p,this->m_symbol_set)].push_back(&*it);
+			}
+			std::vector<const group_type *> g_vec;
+			for (const auto &g: groups) {
+				g_vec.push_back(&g.second);
+			}
+			auto group_product = [this,&s,&new_ss,&pow_f,&cf_f,&key_f](const group_type &g) -> RetT {
+				piranha_assert(!g.empty());
+				const auto rep_sub = pow_f(g.front()->m_key);
+				polynomial tmp;
+				tmp.m_symbol_set = new_ss;
+				tmp.m_container.rehash(boost::numeric_cast<typename polynomial::size_type>(std::ceil(static_cast<double>(g.size()) /
+					tmp.m_container.max_load_factor())));
+				for (const auto &t: g) {
+					tmp.insert(term_type(cf_f(t->m_cf),key_f(t->m_key,rep_sub.second)));
+				}
+				return tmp * rep_sub.first;
+			};
+			// NOTE: if there are fewer groups than threads, the groups are processed in the main thread, where the
+			// products can use all the threads.
+			const unsigned n_threads = (g_vec.size() < settings::get_n_threads()) ? 1u :
+				std::min(thread_pool::use_threads(static_cast<unsigned long long>(this->size()),500ull),
+				static_cast<unsigned>(g_vec.size()));
+			RetT retval = RetT();
+			if (n_threads == 1u) {
+				for (const auto &g: g_vec) {
+					retval += group_product(*g);
+				}
+				return retval;
+			}
+			// Each thread accumulates the products of a subset of the groups.
+			std::vector<RetT> partials(n_threads);
+			auto thread_function = [n_threads,&g_vec,&partials,&group_product](unsigned i) {
+				for (auto j = static_cast<decltype(g_vec.size())>(i); j < g_vec.size(); j += n_threads) {
+					partials[i] += group_product(*g_vec[j]);
+				}
+			};
+			future_list<decltype(thread_pool::enqueue(0u,thread_function,0u))> f_list;
+			try {
+				for (unsigned i = 0u; i < n_threads; ++i) {
+					f_list.push_back(thread_pool::enqueue(i,thread_function,i));
+				}
+				f_list.wait_all();
+				f_list.get_all();
+			} catch (...) {
+				f_list.wait_all();
+				throw;
+			}
+			retval = std::move(partials[0u]);
+			for (unsigned i = 1u; i < n_threads; ++i) {
+				retval += std::move(partials[i]);
+			}
+			return retval;
+		}
+		// Substitution, grouped implementation.
+		template <typename T>
+		typename subs_type<T>::type subs_impl(const std::string &name, const T &x, const std::true_type &) const
+		{
+			typedef typename base::term_type term_type;
+			typedef typename term_type::cf_type cf_type;
+			typedef typename term_type::key_type key_type;
+			const symbol s(name);
+			// The substituted symbol is removed from the keys.
+			const bool has_s = std::binary_search(this->m_symbol_set.begin(),this->m_symbol_set.end(),s);
+			symbol_set sset(this->m_symbol_set);
+			if (has_s) {
+				sset.remove(s);
+			}
+			const symbol_set s_set({s});
+			return grouped_subs<typename subs_type<T>::type>(s,sset,
+				[this,&s,&x](const key_type &k) {return k.subs(s,x,this->m_symbol_set);},
+				[&name,&x](const cf_type &cf) {return math::subs(cf,name,x);},
+				[this,has_s,&s_set](const key_type &k, const key_type &) {return has_s ? k.trim(s_set,this->m_symbol_set) : k;});
+		}
+		// Substitution, term-by-term implementation.
+		template <typename T>
+		typename subs_type<T>::type subs_impl(const std::string &name, const T &x, const std::false_type &) const
+		{
+			typedef typename subs_type<T>::type return_type;
+			typedef typename base::term_type term_type;
+			typedef typename term_type::cf_type cf_type;
+			typedef typename term_type::key_type key_type;
+			// Turn name into symbol.
+			const symbol s(name);
+			// Init return value.
+			return_type retval = return_type();
+			// Remove the symbol from the current symbol set, if present.
+			symbol_set sset(this->m_symbol_set);
+			if (std::binary_search(sset.begin(),sset.end(),s)) {
+				sset.remove(s);
+			}
+			const auto it_f = this->m_container.end();
+			for (auto it = this->m_container.begin(); it != it_f; ++it) {
+				auto cf_sub = math::subs(it->m_cf,name,x);
+				auto key_sub = it->m_key.subs(s,x,this->m_symbol_set);
+				polynomial tmp_series;
+				tmp_series.m_symbol_set = sset;
+				tmp_series.insert(term_type(cf_type(1),key_type(key_sub.second)));
+				retval += (cf_sub * tmp_series) * key_sub.first;
+			}
+			return retval;
+		}
+		// Substitution of integral power, grouped implementation.
+		template <typename T>
+		typename ipow_subs_type<T>::type ipow_subs_impl(const std::string &name, const integer &n, const T &x, const std::true_type &) const
+		{
+			typedef typename base::term_type term_type;
+			typedef typename term_type::cf_type cf_type;
+			typedef typename term_type::key_type key_type;
+			const symbol s(name);
+			// The keys in a group all have the same exponent for s, thus they are all reduced by multiplying them by
+			// the ratio between the reduced first key and the first key, if the reduction changes it.
+			auto pow_f = [this,&s,&n,&x](const key_type &k) {
+				auto k_sub = k.ipow_subs(s,n,x,this->m_symbol_set);
+				std::pair<bool,key_type> shift(!(k_sub.second == k),key_type{});
+				if (shift.first) {
+					k.pow(-1,this->m_symbol_set).multiply(shift.second,k_sub.second,this->m_symbol_set);
+				}
+				return std::make_pair(std::move(k_sub.first),std::move(shift));
+			};
+			auto key_f = [this](const key_type &k, const std::pair<bool,key_type> &shift) -> key_type {
+				if (!shift.first) {
+					return k;
+				}
+				key_type retval;
+				k.multiply(retval,shift.second,this->m_symbol_set);
+				return retval;
+			};
+			return grouped_subs<typename ipow_subs_type<T>::type>(s,this->m_symbol_set,pow_f,
+				[&name,&n,&x](const cf_type &cf) {return math::ipow_subs(cf,name,n,x);},key_f);
+		}
+		// Substitution of integral power, term-by-term implementation.
+		template <typename T>
+		typename ipow_subs_type<T>::type ipow_subs_impl(const std::string &name, const integer &n, const T &x, const std::false_type &) const
+		{
+			typedef typename ipow_subs_type<T>::type return_type;
+			typedef typename base::term_type term_type;
+			typedef typename term_type::cf_type cf_type;
+			typedef typename term_type::key_type key_type;
+			// Turn name into symbol.
+			const symbol s(name);
+			// Init return value.
+			return_type retval = return_type();
+			const auto it_f = this->m_container.end();
+			for (auto it = this->m_container.begin(); it != it_f; ++it) {
+				auto cf_sub = math::ipow_subs(it->m_cf,name,n,x);
+				auto key_sub = it->m_key.ipow_subs(s,n,x,this->m_symbol_set);
+				polynomial tmp_series;
+				tmp_series.m_symbol_set = this->m_symbol_set;
+				tmp_series.insert(term_type(cf_type(1),key_type(key_sub.second)));
+				retval += (cf_sub * tmp_series) * key_sub.first;
+			}
+			return retval;
+		}
 		// Integration with integrable coefficient.
 		polynomial integrate_impl(const symbol &s, const typename base::term_type &term,
 			const std::true_type &) const
@@ -349,6 +544,11 @@ class polynomial:
 		 * via piranha::math::subs() for the coefficients and via the substitution method for the monomials, and
 		 * then assembled into the final return value via multiplications and additions.
 		 * 
+		 * If the substitution does not change the type of the coefficients, the terms are grouped according to the
+		 * exponent of \p name. The power of \p x is then computed only once per group, and each group is collected in a single
+		 * polynomial which is multiplied by the power. The groups are processed in parallel if
+		 * there are at least as many groups as threads (see piranha::settings::get_n_threads()).
+		 * 
 		 * @param[in] name name of the symbolic variable that will be subject to substitution.
 		 * @param[in] x quantity that will be substituted for \p name.
 		 * 
@@ -360,6 +560,7 @@ class polynomial:
 		 * - piranha::math::subs(),
 		 * - the substitution method of the monomial type,
 		 * - piranha::series::insert(),
+		 * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
 		 * - construction, addition and multiplication of the types involved in the computation.
 		 * 
 		 * \todo type requirements.
@@ -371,31 +572,16 @@ class polynomial:
 			typedef typename base::term_type term_type;
 			typedef typename term_type::cf_type cf_type;
 			typedef typename term_type::key_type key_type;
-			// Turn name into symbol.
-			const symbol s(name);
-			// Init return value.
-			return_type retval = return_type();
-			// Remove the symbol from the current symbol set, if present.
-			symbol_set sset(this->m_symbol_set);
-			if (std::binary_search(sset.begin(),sset.end(),s)) {
-				sset.remove(s);
-			}
-			const auto it_f = this->m_container.end();
-			for (auto it = this->m_container.begin(); it != it_f; ++it) {
-				auto cf_sub = math::subs(it->m_cf,name,x);
-				auto key_sub = it->m_key.subs(s,x,this->m_symbol_set);
-				polynomial tmp_series;
-				tmp_series.m_symbol_set = sset;
-				tmp_series.insert(term_type(cf_type(1),key_type(key_sub.second)));
-				retval += (cf_sub * tmp_series) * key_sub.first;
-			}
-			return retval;
+			typedef grouped_subs_enabler<return_type,decltype(math::subs(std::declval<const cf_type &>(),name,x)),
+				decltype(std::declval<const key_type &>().subs(std::declval<const symbol &>(),x,std::declval<const symbol_set &>()))> enabler;
+			return subs_impl(name,x,std::integral_constant<bool,enabler::value>());
 		}
 		/// Substitution of integral power.
 		/**
 		 * This method will substitute occurrences of \p name to the power of \p n with \p x.
 		 * The result for each term is computed via piranha::math::ipow_subs() for the coefficients and via the
 		 * corresponding substitution method for the monomials, and then assembled into the final return value via multiplications and additions.
+		 * The same grouping strategy as in subs() is used where possible.
 		 * 
 		 * @param[in] name name of the symbolic variable that will be subject to substitution.
 		 * @param[in] n power of \p name that will be substituted.
@@ -407,8 +593,9 @@ class polynomial:
 		 * - symbol construction,
 		 * - the assignment operator of piranha::symbol_set,
 		 * - piranha::math::ipow_subs(),
-		 * - the substitution method of the monomial type,
+		 * - the substitution, exponentiation and multiplication methods of the monomial type,
 		 * - piranha::series::insert(),
+		 * - piranha::thread_pool::enqueue() and piranha::future_list::push_back(),
 		 * - construction, addition and multiplication of the types involved in the computation.
 		 * 
 		 * \todo type requirements.
@@ -420,20 +607,9 @@ class polynomial:
 			typedef typename base::term_type term_type;
 			typedef typename term_type::cf_type cf_type;
 			typedef typename term_type::key_type key_type;
-			// Turn name into symbol.
-			const symbol s(name);
-			// Init return value.
-			return_type retval = return_type();
-			const auto it_f = this->m_container.end();
-			for (auto it = this->m_container.begin(); it != it_f; ++it) {
-				auto cf_sub = math::ipow_subs(it->m_cf,name,n,x);
-				auto key_sub = it->m_key.ipow_subs(s,n,x,this->m_symbol_set);
-				polynomial tmp_series;
-				tmp_series.m_symbol_set = this->m_symbol_set;
-				tmp_series.insert(term_type(cf_type(1),key_type(key_sub.second)));
-				retval += (cf_sub * tmp_series) * key_sub.first;
-			}
-			return retval;
+			typedef grouped_subs_enabler<return_type,decltype(math::ipow_subs(std::declval<const cf_type &>(),name,n,x)),
+				decltype(std::declval<const key_type &>().ipow_subs(std::declval<const symbol &>(),n,x,std::declval<const symbol_set &>()))> enabler;
+			return ipow_subs_impl(name,n,x,std::integral_constant<bool,enabler::value>());
 		}
 		/// Integration.
 		/**
@@ -619,6 +795,51 @@ struct kronecker_enabler
 		std::is_base_of<detail::polynomial_tag,Series2>::value && are_same_kronecker_monomial<key_type1,key_type2>::value;
 };
 
+// Primes used in multi-modular multiplication: the largest primes below 2**31.
+template <typename = int>
+struct crt_primes
+{
+	static const std::size_t size = 6u;
+	static constexpr std::uint_least32_t values[size] = {
+		2147483647ul, 2147483629ul, 2147483587ul, 2147483579ul, 2147483563ul, 2147483549ul
+	};
+};
+
+template <typename T>
+const std::size_t crt_primes<T>::size;
+
+template <typename T>
+constexpr std::uint_least32_t crt_primes<T>::values[crt_primes<T>::size];
+
+// Polynomial with the same key as Series and coefficients modulo P.
+template <typename Series, std::uint_least32_t P>
+struct crt_rebind {};
+
+template <typename Cf, typename Expo, typename S, std::uint_least32_t P>
+struct crt_rebind<polynomial<Cf,Expo,S>,P>
+{
+	typedef polynomial<modular_integer<P>,Expo,S> type;
+};
+
+// Multi-modular multiplication is enabled for polynomials of the same type with mp_integer coefficients.
+template <typename Series1, typename Series2>
+struct crt_enabler
+{
+	static const bool value = std::is_same<Series1,Series2>::value && is_instance_of<Series1,polynomial>::value &&
+		is_mp_integer<typename Series1::term_type::cf_type>::value;
+};
+
+// Tuple of the modular polynomial types corresponding to Series.
+template <typename Series>
+struct crt_tuple
+{
+	typedef crt_primes<> primes;
+	template <std::size_t N>
+	using rebind = typename crt_rebind<Series,primes::values[N]>::type;
+	typedef std::tuple<rebind<0u>,rebind<1u>,rebind<2u>,rebind<3u>,rebind<4u>,rebind<5u>> type;
+	static_assert(std::tuple_size<type>::value == primes::size,"Invalid size for the tuple of modular polynomials.");
+};
+
 }
 
 /// Series multiplier specialisation for polynomials with Kronecker monomials.
@@ -628,6 +849,10 @@ struct kronecker_enabler
  * This multiplier will employ optimized algorithms that take advantage of the properties of Kronecker monomials.
  * It will also take advantage of piranha::math::multiply_accumulate() in place of plain coefficient multiplication
  * when possible.
+ *
+ * If \p Series1 and \p Series2 are the same polynomial type with piranha::mp_integer coefficients and
+ * piranha::tuning::get_crt_multiplication() returns \p true, the multiplication will be performed via
+ * multi-modular arithmetic and the Chinese remainder theorem.
  * 
  * \section exception_safety Exception safety guarantee
  * 
@@ -726,19 +951,22 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			std::transform(minmax_values1.begin(),minmax_values1.end(),minmax_values2.begin(),
 				std::back_inserter(m_minmax_values),[](const std::pair<value_type,value_type> &p1,
 				const std::pair<value_type,value_type> &p2) {
-					return std::make_pair(integer(p1.first) + integer(p2.first),integer(p1.second) + integer(p2.second));
+					return std::make_pair(detail::ka_to_integer(p1.first) + detail::ka_to_integer(p2.first),
+						detail::ka_to_integer(p1.second) + detail::ka_to_integer(p2.second));
 			});
 			piranha_assert(m_minmax_values.size() == minmax_vec.size());
 			piranha_assert(m_minmax_values.size() == minmax_values1.size());
 			piranha_assert(m_minmax_values.size() == minmax_values2.size());
 			for (decltype(m_minmax_values.size()) i = 0u; i < m_minmax_values.size(); ++i) {
-				if (unlikely(m_minmax_values[i].first < -minmax_vec[i] || m_minmax_values[i].second > minmax_vec[i])) {
+				if (unlikely(m_minmax_values[i].first < -detail::ka_to_integer(minmax_vec[i]) ||
+					m_minmax_values[i].second > detail::ka_to_integer(minmax_vec[i])))
+				{
 					piranha_throw(std::overflow_error,"Kronecker monomial components are out of bounds");
 				}
 				// Update with the ranges of the operands.
 				m_minmax_values[i] = std::minmax({m_minmax_values[i].first,
-					integer(minmax_values1[i].first),integer(minmax_values2[i].first),m_minmax_values[i].second,
-					integer(minmax_values1[i].second),integer(minmax_values2[i].second)});
+					detail::ka_to_integer(minmax_values1[i].first),detail::ka_to_integer(minmax_values2[i].first),m_minmax_values[i].second,
+					detail::ka_to_integer(minmax_values1[i].second),detail::ka_to_integer(minmax_values2[i].second)});
 			}
 		}
 		/// Perform multiplication.
@@ -754,7 +982,9 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 		 * - threading primitives,
 		 * - memory allocation errors in standard containers,
 		 * - piranha::thread_pool::enqueue(),
-		 * - piranha::future_list::push_back().
+		 * - piranha::future_list::push_back(),
+		 * - the arithmetic operations on piranha::mp_integer and piranha::modular_integer, and the conversion operators
+		 *   of the series involved in multi-modular multiplication.
 		 */
 		return_type operator()() const
 		{
@@ -911,6 +1141,154 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			const std::vector<term_type1 const *>	&m_v1;
 			const std::vector<term_type2 const *>	&m_v2;
 		};
+		// Multi-modular multiplication.
+		// Compute the products modulo the first k primes, storing the results in res.
+		template <std::size_t N, typename Tuple>
+		void crt_multiply(Tuple &, const std::size_t &, const unsigned &, future_list<std::future<void>> &,
+			typename std::enable_if<N == std::tuple_size<Tuple>::value>::type * = nullptr) const
+		{}
+		template <std::size_t N, typename Tuple>
+		void crt_multiply(Tuple &res, const std::size_t &k, const unsigned &n_threads, future_list<std::future<void>> &f_list,
+			typename std::enable_if<(N < std::tuple_size<Tuple>::value)>::type * = nullptr) const
+		{
+			if (N >= k) {
+				return;
+			}
+			auto f = [&res,this]() {
+				typedef typename std::tuple_element<N,Tuple>::type s_type;
+				std::get<N>(res) = s_type(*this->m_s1) * s_type(*this->m_s2);
+			};
+			if (n_threads == 1u) {
+				f();
+			} else {
+				f_list.push_back(thread_pool::enqueue(static_cast<unsigned>(N % n_threads),f));
+			}
+			crt_multiply<N + 1u>(res,k,n_threads,f_list);
+		}
+		// Collect the residues of the coefficients of the modular products, indexed by Kronecker code.
+		template <std::size_t N, typename Tuple, typename Map>
+		static void crt_collect(const Tuple &, const std::size_t &, Map &,
+			typename std::enable_if<N == std::tuple_size<Tuple>::value>::type * = nullptr)
+		{}
+		template <std::size_t N, typename Tuple, typename Map>
+		static void crt_collect(const Tuple &res, const std::size_t &k, Map &m,
+			typename std::enable_if<(N < std::tuple_size<Tuple>::value)>::type * = nullptr)
+		{
+			if (N >= k) {
+				return;
+			}
+			// NOTE: the keys missing from a modular product correspond to coefficients divisible by the N-th
+			// prime, and their residues stay zero from the value-initialisation of the array.
+			for (const auto &t: std::get<N>(res).m_container) {
+				m[t.m_key.get_int()][N] = t.m_cf.get_value();
+			}
+			crt_collect<N + 1u>(res,k,m);
+		}
+		// Inverse of a modulo p, with p prime.
+		static std::uint_least64_t crt_inverse(std::uint_least64_t a, const std::uint_least64_t &p)
+		{
+			std::uint_least64_t retval = 1u, n = p - 2u;
+			a %= p;
+			while (n) {
+				if (n & 1u) {
+					retval = (retval * a) % p;
+				}
+				a = (a * a) % p;
+				n >>= 1u;
+			}
+			return retval;
+		}
+		template <typename T = Series1, typename std::enable_if<!detail::crt_enabler<T,Series2>::value,int>::type = 0>
+		bool crt_multiplication(return_type &) const
+		{
+			return false;
+		}
+		// The algorithm is the following:
+		// - compute a bound B on the absolute values of the coefficients of the result and select the
+		//   first k primes whose product M is greater than 2 * B (if there are not enough primes, give up);
+		// - reduce the operands modulo the primes and multiply them, in parallel if possible;
+		// - reconstruct the coefficients in the symmetric range (-M / 2, M / 2] via Garner's algorithm.
+		template <typename T = Series1, typename std::enable_if<detail::crt_enabler<T,Series2>::value,int>::type = 0>
+		bool crt_multiplication(return_type &retval) const
+		{
+			typedef typename term_type1::cf_type cf_type;
+			typedef typename detail::crt_tuple<T>::primes primes;
+			typedef typename detail::crt_tuple<T>::type tuple_type;
+			auto max_abs = [](const std::vector<term_type1 const *> &v) -> cf_type {
+				cf_type retval(0);
+				for (const auto &ptr: v) {
+					const auto tmp = math::abs(ptr->m_cf);
+					if (tmp > retval) {
+						retval = tmp;
+					}
+				}
+				return retval;
+			};
+			const auto min_size = std::min(this->m_v1.size(),this->m_v2.size());
+			const cf_type bound = max_abs(this->m_v1) * max_abs(this->m_v2) * cf_type(min_size) * 2;
+			std::size_t k = 0u;
+			cf_type M(1);
+			for (; k < primes::size && M <= bound; ++k) {
+				M *= primes::values[k];
+			}
+			if (M <= bound) {
+				return false;
+			}
+			// Modular products.
+			tuple_type res;
+			// NOTE: the modular products are executed in single-threaded mode if they run in the thread pool,
+			// so here we just distribute them among the available threads.
+			const unsigned n_threads = thread_pool::use_threads(integer(k),integer(1));
+			{
+				future_list<std::future<void>> f_list;
+				try {
+					crt_multiply<0u>(res,k,n_threads,f_list);
+					f_list.wait_all();
+					f_list.get_all();
+				} catch (...) {
+					f_list.wait_all();
+					throw;
+				}
+			}
+			std::unordered_map<value_type,std::array<std::uint_least32_t,primes::size>,detail::ka_hasher> residues;
+			crt_collect<0u>(res,k,residues);
+			res = tuple_type{};
+			// Garner's coefficients: inverses of the j-th prime modulo the i-th prime, for j < i.
+			std::array<std::array<std::uint_least64_t,primes::size>,primes::size> inv;
+			for (std::size_t i = 0u; i < k; ++i) {
+				for (std::size_t j = 0u; j < i; ++j) {
+					inv[j][i] = crt_inverse(primes::values[j],primes::values[i]);
+				}
+			}
+			const cf_type half_M = M / 2;
+			retval.m_symbol_set = this->m_s1->m_symbol_set;
+			retval.m_container.rehash(boost::numeric_cast<typename Series1::size_type>(std::ceil(static_cast<double>(residues.size()) /
+				retval.m_container.max_load_factor())));
+			std::array<std::uint_least64_t,primes::size> v;
+			cf_type tmp;
+			for (const auto &p: residues) {
+				// Mixed-radix digits.
+				for (std::size_t i = 0u; i < k; ++i) {
+					const std::uint_least64_t p_i = primes::values[i];
+					std::uint_least64_t t = p.second[i];
+					for (std::size_t j = 0u; j < i; ++j) {
+						t = (((t + p_i - v[j] % p_i) % p_i) * inv[j][i]) % p_i;
+					}
+					v[i] = t;
+				}
+				// Horner evaluation of the mixed-radix representation.
+				tmp = v[k - 1u];
+				for (std::size_t i = k - 1u; i > 0u; --i) {
+					tmp *= primes::values[i - 1u];
+					tmp += v[i - 1u];
+				}
+				if (tmp > half_M) {
+					tmp -= M;
+				}
+				retval.insert(term_type1(tmp,typename term_type1::key_type(p.first)));
+			}
+			return true;
+		}
 		return_type execute() const
 		{
 			const index_type size1 = this->m_v1.size(), size2 = boost::numeric_cast<index_type>(this->m_v2.size());
@@ -924,8 +1302,11 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			if (unlikely(max_size > boost::integer_traits<bucket_size_type>::const_max)) {
 				piranha_throw(std::overflow_error,"possible overflow in series size");
 			}
-			// First, let's get the estimation on the size of the final series.
 			return_type retval;
+			if (tuning::get_crt_multiplication() && crt_multiplication(retval)) {
+				return retval;
+			}
+			// First, let's get the estimation on the size of the final series.
 			retval.m_symbol_set = this->m_s1->m_symbol_set;
 			typename Series1::size_type estimate;
 			// Use the sparse functor for the estimation.
@@ -1026,11 +1407,11 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			// Vectors of minimum / maximum values, cast to hardware int.
 			std::vector<value_type> mins;
 			std::transform(m_minmax_values.begin(),m_minmax_values.end(),std::back_inserter(mins),[](const std::pair<integer,integer> &p) {
-				return static_cast<value_type>(p.first);
+				return detail::ka_from_integer<value_type>(p.first);
 			});
 			std::vector<value_type> maxs;
 			std::transform(m_minmax_values.begin(),m_minmax_values.end(),std::back_inserter(maxs),[](const std::pair<integer,integer> &p) {
-				return static_cast<value_type>(p.second);
+				return detail::ka_from_integer<value_type>(p.second);
 			});
 			// Build the encoding vector.
 			std::vector<value_type> c_vec;
@@ -1039,10 +1420,10 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 				[&f_delta](const std::pair<integer,integer> &p) -> value_type {
 					auto old(f_delta);
 					f_delta *= p.second - p.first + 1;
-					return static_cast<value_type>(old);
+					return detail::ka_from_integer<value_type>(old);
 			});
 			// Try casting final delta.
-			(void)static_cast<value_type>(f_delta);
+			(void)detail::ka_from_integer<value_type>(f_delta);
 			// Compute hmax and hmin.
 			piranha_assert(m_minmax_values.size() == c_vec.size());
 			const auto h_minmax = std::inner_product(m_minmax_values.begin(),m_minmax_values.end(),c_vec.begin(),
@@ -1050,13 +1431,13 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 				[](const std::pair<integer,integer> &p1, const std::pair<integer,integer> &p2) {
 					return std::make_pair(p1.first + p2.first,p1.second + p2.second);
 				},[](const std::pair<integer,integer> &p, const value_type &value) {
-					return std::make_pair(p.first * value,p.second * value);
+					return std::make_pair(p.first * detail::ka_to_integer(value),p.second * detail::ka_to_integer(value));
 				}
 			);
 			piranha_assert(f_delta == h_minmax.second - h_minmax.first + 1);
 			// Try casting hmax and hmin.
-			const auto hmin = static_cast<value_type>(h_minmax.first);
-			const auto hmax = static_cast<value_type>(h_minmax.second);
+			const auto hmin = detail::ka_from_integer<value_type>(h_minmax.first);
+			const auto hmax = detail::ka_from_integer<value_type>(h_minmax.second);
 			// Encoding functor.
 			typedef typename term_type1::key_type::v_type unpack_type;
 			auto encoder = [&c_vec,hmin,&mins](const unpack_type &v) -> value_type {
@@ -1111,10 +1492,10 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			{
 				piranha_assert(i_end <= new_keys1.size() && j_end <= new_keys2.size());
 				piranha_assert(i_start < i_end && j_start < j_end);
-				const bucket_size_type a = boost::numeric_cast<bucket_size_type>((new_keys1[i_start].first + new_keys2[j_start].first) - hmin);
-				const bucket_size_type b = boost::numeric_cast<bucket_size_type>((new_keys1[i_end - 1u].first + new_keys2[j_end - 1u].first) - hmin);
+				const bucket_size_type a = detail::ka_numeric_cast<bucket_size_type>((new_keys1[i_start].first + new_keys2[j_start].first) - hmin);
+				const bucket_size_type b = detail::ka_numeric_cast<bucket_size_type>((new_keys1[i_end - 1u].first + new_keys2[j_end - 1u].first) - hmin);
 				piranha_assert(a <= b);
-				piranha_assert(b <= boost::numeric_cast<bucket_size_type>(hmax - hmin));
+				piranha_assert(b <= detail::ka_numeric_cast<bucket_size_type>(hmax - hmin));
 				return task_type{std::make_pair(i_start,i_end),std::make_pair(j_start,j_end),
 					std::make_pair(a,b),std::make_pair(bucket_size_type(0u),bucket_size_type(0u)),false};
 			};
@@ -1142,7 +1523,7 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			// NOTE: init everything explicitly to zero, as we make no assumption about the value of a default-cted
 			// coefficient.
 			using cf_vector_type = std::vector<typename term_type1::cf_type>;
-			 cf_vector_type cf_vector(boost::numeric_cast<typename cf_vector_type::size_type>((hmax - hmin) + 1),
+			 cf_vector_type cf_vector(detail::ka_numeric_cast<typename cf_vector_type::size_type>((hmax - hmin) + 1),
 				typename term_type1::cf_type(0));
 			if (n_threads == 1u) {
 				// Single-thread multiplication.
@@ -1154,7 +1535,7 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 					for (index_type i = i_start; i < i_end; ++i) {
 						for (index_type j = j_start; j < j_end; ++j) {
 							const auto idx = (new_keys1[i].first + new_keys2[j].first) - hmin;
-							piranha_assert(idx < boost::numeric_cast<value_type>(cf_vector.size()));
+							piranha_assert(idx < detail::ka_numeric_cast<value_type>(cf_vector.size()));
 							math::multiply_accumulate(cf_vector[static_cast<decltype(cf_vector.size())>(idx)],
 								new_keys1[i].second->m_cf,new_keys2[j].second->m_cf);
 						}
@@ -1221,7 +1602,7 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 							for (index_type i = i_start; i < i_end; ++i) {
 								for (index_type j = j_start; j < j_end; ++j) {
 									const auto idx = (new_keys1[i].first + new_keys2[j].first) - hmin;
-									piranha_assert(idx < boost::numeric_cast<value_type>(cf_vector.size()));
+									piranha_assert(idx < detail::ka_numeric_cast<value_type>(cf_vector.size()));
 									math::multiply_accumulate(cf_vector[static_cast<decltype(cf_vector.size())>(idx)],
 										new_keys1[i].second->m_cf,new_keys2[j].second->m_cf);
 								}
@@ -1274,7 +1655,7 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			}
 			// Build the return value.
 			// Append the final delta to the coding vector for use in the decoding routine.
-			c_vec.push_back(static_cast<value_type>(f_delta));
+			c_vec.push_back(detail::ka_from_integer<value_type>(f_delta));
 			// Temp vector for decoding.
 			std::vector<value_type> tmp_v;
 			tmp_v.resize(boost::numeric_cast<decltype(tmp_v.size())>(this->m_s1->m_symbol_set.size()));
@@ -1296,7 +1677,7 @@ class series_multiplier<Series1,Series2,typename std::enable_if<detail::kronecke
 			for (decltype(cf_vector.size()) i = 0u; i < cf_size; ++i) {
 				if (!math::is_zero(cf_vector[i])) {
 					tmp_term.m_cf = std::move(cf_vector[i]);
-					decoder(boost::numeric_cast<value_type>(i));
+					decoder(detail::ka_numeric_cast<value_type>(i));
 					tmp_term.m_key = decltype(tmp_term.m_key)(tmp_v.begin(),tmp_v.end());
 					retval.insert(std::move(tmp_term));
 				}
@@ -21,6 +21,7 @@
 #ifndef PIRANHA_POLYNOMIAL_TERM_HPP
 #define PIRANHA_POLYNOMIAL_TERM_HPP
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -28,6 +29,7 @@
 
 #include "base_term.hpp"
 #include "detail/series_fwd.hpp"
+#include "fixed_monomial.hpp"
 #include "forwarding.hpp"
 #include "kronecker_monomial.hpp"
 #include "math.hpp"
@@ -61,6 +63,12 @@ struct polynomial_term_key<kronecker_monomial<T>,S>
 	typedef kronecker_monomial<T> type;
 };
 
+template <typename T, std::size_t N, typename S>
+struct polynomial_term_key<fixed_monomial<T,N>,S>
+{
+	typedef fixed_monomial<T,N> type;
+};
+
 }
 
 /// Polynomial term.
@@ -70,6 +78,7 @@ struct polynomial_term_key<kronecker_monomial<T>,S>
  * 
  * - if \p Expo is piranha::univariate_monomial of \p T, the key will also be piranha::univariate_monomial of \p T,
  * - if \p Expo is piranha::kronecker_monomial of \p T, the key will also be piranha::kronecker_monomial of \p T,
+ * - if \p Expo is piranha::fixed_monomial of \p T and \p N, the key will also be piranha::fixed_monomial of \p T and \p N,
  * - otherwise, the key will be piranha::monomial of \p Expo and \p S.
  * 
  * Examples:
@@ -90,6 +99,10 @@ struct polynomial_term_key<kronecker_monomial<T>,S>
  polynomial_term<double,kronecker_monomial<>>
  @endcode
  * is a multivariate polynomial term with double-precision coefficient and integral exponents packed into a piranha::kronecker_monomial.
+ @code
+ polynomial_term<double,fixed_monomial<short,6>>
+ @endcode
+ * is a multivariate polynomial term with double-precision coefficient and \p short exponents, in at most 6 variables.
  * 
  * \section type_requirements Type requirements
  * 
@@ -98,7 +111,7 @@ struct polynomial_term_key<kronecker_monomial<T>,S>
  *   - piranha::is_multipliable and piranha::is_multipliable_in_place,
  *   - piranha::has_multiply_accumulate.
  * - \p Expo and \p S must be suitable for use in piranha::monomial, or \p Expo must be an instance of
- *   piranha::univariate_monomial or piranha::kronecker_monomial.
+ *   piranha::univariate_monomial, piranha::kronecker_monomial or piranha::fixed_monomial.
  * 
  * \section exception_safety Exception safety guarantee
  * 
@@ -139,6 +139,19 @@ class power_series: public Series
 				return PIRANHA_TMP_RETURN;
 			}
 			#undef PIRANHA_TMP_RETURN
+			// Partial degree with precomputed positions.
+			template <typename Term>
+			static auto pget(const Term &t, const symbol_set &s, const std::set<std::string> &, const symbol_set::positions &p) ->
+				decltype(t.m_key.degree(p,s))
+			{
+				return t.m_key.degree(p,s);
+			}
+			template <typename Term>
+			static auto plget(const Term &t, const symbol_set &s, const std::set<std::string> &, const symbol_set::positions &p) ->
+				decltype(t.m_key.ldegree(p,s))
+			{
+				return t.m_key.ldegree(p,s);
+			}
 		};
 		// Case 3: cf and key have both degree/ldegree.
 		template <typename T>
@@ -164,7 +177,83 @@ class power_series: public Series
 				return math::ldegree(t.m_cf,args...) + t.m_key.ldegree(args...,s);
 			}
 			#undef PIRANHA_TMP_RETURN
+			// Partial degree with precomputed positions.
+			template <typename Term>
+			static auto pget(const Term &t, const symbol_set &s, const std::set<std::string> &names, const symbol_set::positions &p) ->
+				decltype(math::degree(t.m_cf,names) + t.m_key.degree(p,s))
+			{
+				return math::degree(t.m_cf,names) + t.m_key.degree(p,s);
+			}
+			template <typename Term>
+			static auto plget(const Term &t, const symbol_set &s, const std::set<std::string> &names, const symbol_set::positions &p) ->
+				decltype(math::ldegree(t.m_cf,names) + t.m_key.ldegree(p,s))
+			{
+				return math::ldegree(t.m_cf,names) + t.m_key.ldegree(p,s);
+			}
+		};
+		// Detect keys which can compute the partial (low) degree from the positions of the active symbols.
+		template <typename Key>
+		class key_has_positions_degree: detail::sfinae_types
+		{
+				template <typename K>
+				static auto test1(const K *k) -> decltype(k->degree(std::declval<const symbol_set::positions &>(),
+					std::declval<const symbol_set &>()),void(),yes());
+				static no test1(...);
+				template <typename K>
+				static auto test2(const K *k) -> decltype(k->ldegree(std::declval<const symbol_set::positions &>(),
+					std::declval<const symbol_set &>()),void(),yes());
+				static no test2(...);
+			public:
+				static const bool value = std::is_same<decltype(test1((Key *)nullptr)),yes>::value &&
+					std::is_same<decltype(test2((Key *)nullptr)),yes>::value;
 		};
+		// The partial degree is computed via positions if the only argument is a set of names and the key supports it.
+		template <typename T, typename ... Args>
+		struct use_positions: std::false_type {};
+		template <typename T>
+		struct use_positions<T,std::set<std::string>>: std::integral_constant<bool,(term_score<T>::value >= 2u) &&
+			key_has_positions_degree<typename T::term_type::key_type>::value>
+		{};
+		template <typename T, typename ... Args>
+		auto degree_impl(const std::false_type &, const Args & ... args) const ->
+			decltype(degree_utils<T>::get(std::declval<typename T::term_type>(),std::declval<symbol_set>(),args...))
+		{
+			auto g = std::bind(degree_utils<T>::template get<typename T::term_type,Args...>,std::placeholders::_1,
+				std::cref(this->m_symbol_set),std::cref(args)...);
+			return detail::generic_series_degree<0>(this->m_container,g);
+		}
+		// NOTE: in the partial degree, the names are resolved into positions once per call, rather than being
+		// matched against the symbol set for each term.
+		template <typename T>
+		auto degree_impl(const std::true_type &, const std::set<std::string> &names) const ->
+			decltype(degree_utils<T>::get(std::declval<typename T::term_type>(),std::declval<symbol_set>(),names))
+		{
+			const symbol_set::positions p(this->m_symbol_set,names);
+			const symbol_set &s = this->m_symbol_set;
+			auto g = [&s,&names,&p](const typename T::term_type &t) {
+				return degree_utils<T>::pget(t,s,names,p);
+			};
+			return detail::generic_series_degree<0>(this->m_container,g);
+		}
+		template <typename T, typename ... Args>
+		auto ldegree_impl(const std::false_type &, const Args & ... args) const ->
+			decltype(degree_utils<T>::lget(std::declval<typename T::term_type>(),std::declval<symbol_set>(),args...))
+		{
+			auto g = std::bind(degree_utils<T>::template lget<typename T::term_type,Args...>,std::placeholders::_1,
+				std::cref(this->m_symbol_set),std::cref(args)...);
+			return detail::generic_series_degree<1>(this->m_container,g);
+		}
+		template <typename T>
+		auto ldegree_impl(const std::true_type &, const std::set<std::string> &names) const ->
+			decltype(degree_utils<T>::lget(std::declval<typename T::term_type>(),std::declval<symbol_set>(),names))
+		{
+			const symbol_set::positions p(this->m_symbol_set,names);
+			const symbol_set &s = this->m_symbol_set;
+			auto g = [&s,&names,&p](const typename T::term_type &t) {
+				return degree_utils<T>::plget(t,s,names,p);
+			};
+			return detail::generic_series_degree<1>(this->m_container,g);
+		}
 	public:
 		/// Defaulted default constructor.
 		power_series() = default;
@@ -193,6 +282,10 @@ class power_series: public Series
 		 * of a set of strings, the partial degree (i.e., calculated considering only the variables in the set) will be returned.
 		 * In all other cases, the call is malformed and the method will be disabled.
 		 *
+		 * If the key type is able to compute the partial degree from the positions of the symbols (as piranha::monomial
+		 * and piranha::kronecker_monomial do), the names in the set will be resolved into positions once, via
+		 * piranha::symbol_set::positions, before iterating over the terms.
+		 *
 		 * @param[in] args variadic parameter pack.
 		 *
 		 * @return the total or partial degree of the series.
@@ -206,9 +299,7 @@ class power_series: public Series
 		auto degree(const Args & ... args) const ->
 			decltype(degree_utils<T>::get(std::declval<typename T::term_type>(),std::declval<symbol_set>(),args...))
 		{
-			auto g = std::bind(degree_utils<T>::template get<typename T::term_type,Args...>,std::placeholders::_1,
-				std::cref(this->m_symbol_set),std::cref(args)...);
-			return detail::generic_series_degree<0>(this->m_container,g);
+			return degree_impl<T>(use_positions<T,Args...>(),args...);
 		}
 		/// Total and partial low degree.
 		/**
@@ -218,7 +309,8 @@ class power_series: public Series
 		 * The low degree of the series is the minimum low degree of its terms. If the series is empty, zero will be returned.
 		 * If the parameter pack has a size of zero, the total low degree will be returned. If the parameter pack consists
 		 * of a set of strings, the partial low degree (i.e., calculated considering only the variables in the set) will be returned.
-		 * In all other cases, the call is malformed and the method will be disabled.
+		 * In all other cases, the call is malformed and the method will be disabled. The partial low degree is computed
+		 * from the positions of the symbols when possible, as explained in degree().
 		 *
 		 * @param[in] args variadic parameter pack.
 		 *
@@ -233,9 +325,7 @@ class power_series: public Series
 		auto ldegree(const Args & ... args) const ->
 			decltype(degree_utils<T>::lget(std::declval<typename T::term_type>(),std::declval<symbol_set>(),args...))
 		{
-			auto g = std::bind(degree_utils<T>::template lget<typename T::term_type,Args...>,std::placeholders::_1,
-				std::cref(this->m_symbol_set),std::cref(args)...);
-			return detail::generic_series_degree<1>(this->m_container,g);
+			return ldegree_impl<T>(use_positions<T,Args...>(),args...);
 		}
 };
 
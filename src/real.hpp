@@ -281,14 +281,23 @@ class real: public detail::real_base<>
 				piranha_throw(std::overflow_error,"error in conversion of real to rational: exponent is too large");
 			}
 		}
+		// Raise the precision of this to prec, preserving the current value.
+		// NOTE: mpfr_prec_round() will reuse the existing limb storage when possible, and
+		// increasing the precision never changes the value. This avoids the init/set/clear
+		// cycle of constructing a new real with a different precision.
+		void promote_prec(const ::mpfr_prec_t &prec)
+		{
+			piranha_assert(m_value->_mpfr_d && prec > get_prec());
+			::mpfr_prec_round(m_value,prec,default_rnd);
+		}
 		// In-place addition.
 		// NOTE: all sorts of optimisations, here and in binary add, are possible (e.g., steal from rvalue ref, 
 		// avoid setting precision twice in binary operators, etc.). For the moment we keep it basic.
 		real &in_place_add(const real &r)
 		{
 			if (r.get_prec() > get_prec()) {
-				// Re-init this with the prec of r.
-				*this = real{*this,r.get_prec()};
+				// Bump the prec of this to the prec of r.
+				promote_prec(r.get_prec());
 			}
 			::mpfr_add(m_value,m_value,r.m_value,default_rnd);
 			return *this;
@@ -344,7 +353,7 @@ class real: public detail::real_base<>
 		real &in_place_sub(const real &r)
 		{
 			if (r.get_prec() > get_prec()) {
-				*this = real{*this,r.get_prec()};
+				promote_prec(r.get_prec());
 			}
 			::mpfr_sub(m_value,m_value,r.m_value,default_rnd);
 			return *this;
@@ -398,7 +407,7 @@ class real: public detail::real_base<>
 		real &in_place_mul(const real &r)
 		{
 			if (r.get_prec() > get_prec()) {
-				*this = real{*this,r.get_prec()};
+				promote_prec(r.get_prec());
 			}
 			::mpfr_mul(m_value,m_value,r.m_value,default_rnd);
 			return *this;
@@ -450,7 +459,7 @@ class real: public detail::real_base<>
 		real &in_place_div(const real &r)
 		{
 			if (r.get_prec() > get_prec()) {
-				*this = real{*this,r.get_prec()};
+				promote_prec(r.get_prec());
 			}
 			::mpfr_div(m_value,m_value,r.m_value,default_rnd);
 			return *this;
@@ -1295,19 +1304,25 @@ class real: public detail::real_base<>
 		{
 			const auto prec1 = std::max< ::mpfr_prec_t>(r1.get_prec(),r2.get_prec());
 			if (prec1 > get_prec()) {
-				*this = real{*this,prec1};
+				promote_prec(prec1);
 			}
 			// So the story here is that mpfr_fma has been reported to be slower than the two separate
 			// operations. Benchmarks on fateman1 indicate this is indeed the case (3.6 vs 2.7 secs
 			// on 4 threads). Hopefully it will be fixed in the future, for now adopt the workaround.
 			// http://www.loria.fr/~zimmerma/mpfr-mpc-2014.html
+			// NOTE: this is still the case with MPFR 4.2 at the default precision (fateman1_real_perf,
+			// single thread: 6.4 secs with mpfr_fma vs 4.9 secs with the two separate operations).
 			//::mpfr_fma(m_value,r1.m_value,r2.m_value,m_value,default_rnd);
 			// NOTE: the tmp var needs to be thread local.
 			static thread_local real tmp;
 			// NOTE: set the same precision as this, which is now the max precision of the 3 operands.
 			// If we do not do this, then tmp has an undeterminate precision. Use the raw MPFR function
 			// in order to avoid the checks in get_prec(), as we know the precision has a sane value.
-			::mpfr_set_prec(tmp.m_value,mpfr_get_prec(m_value));
+			// The precision is changed only when needed, so that in the common case of accumulation
+			// with operands of uniform precision the scratch value is never touched.
+			if (mpfr_get_prec(tmp.m_value) != mpfr_get_prec(m_value)) {
+				::mpfr_set_prec(tmp.m_value,mpfr_get_prec(m_value));
+			}
 			::mpfr_mul(tmp.m_value,r1.m_value,r2.m_value,MPFR_RNDN);
 			::mpfr_add(m_value,m_value,tmp.m_value,MPFR_RNDN);
 			return *this;
@@ -1534,6 +1549,164 @@ class real: public detail::real_base<>
 			::mpfr_const_pi(retval.m_value,default_rnd);
 			return retval;
 		}
+		/// Append the decimal representation to a string.
+		/**
+		 * The decimal representation of \p this (the same produced by the stream operator) will be appended
+		 * to \p out. This method is intended for the conversion of many values in bulk: MPFR writes the digits
+		 * directly into \p out, so that, by reusing the same output string, no memory allocation is needed in the common case.
+		 *
+		 * @param[in,out] out output string.
+		 *
+		 * @throws std::invalid_argument if the conversion to string via the MPFR API fails.
+		 * @throws std::overflow_error if the exponent is smaller than an implementation-defined minimum.
+		 * @throws unspecified any exception thrown by memory allocation errors in \p std::string.
+		 */
+		void to_decimal(std::string &out) const
+		{
+			if (is_nan()) {
+				out.append("nan");
+				return;
+			}
+			if (is_inf()) {
+				out.append(sign() > 0 ? "inf" : "-inf");
+				return;
+			}
+			// NOTE: when asked for zero digits, MPFR produces 1 + ceil(prec * log10(2)) digits (in rare cases, one more).
+			// The buffer needs two extra characters for the sign and the terminator, and it must be at least 7 characters
+			// long. We leave room for the radix point at the beginning.
+			const std::size_t n_digits = static_cast<std::size_t>(std::ceil(static_cast<double>(get_prec()) * 0.30102999566398120)) + 2u;
+			const auto old_size = out.size();
+			out.resize(old_size + 1u + std::max<std::size_t>(n_digits + 2u,7u));
+			::mpfr_exp_t exp(0);
+			char *cptr = ::mpfr_get_str(&out[old_size + 1u],&exp,10,0,m_value,default_rnd);
+			if (unlikely(!cptr)) {
+				out.resize(old_size);
+				piranha_throw(std::invalid_argument,"error in conversion of real to string: the call to the MPFR function failed");
+			}
+			const auto length = std::char_traits<char>::length(cptr);
+			// Move the sign and the first digit one position back, and insert the radix point after them.
+			const std::size_t n_lead = (*cptr == '-') ? 2u : 1u;
+			std::copy(cptr,cptr + n_lead,&out[old_size]);
+			out[old_size + n_lead] = '.';
+			out.resize(old_size + 1u + length);
+			if (exp == std::numeric_limits< ::mpfr_exp_t>::min()) {
+				out.resize(old_size);
+				piranha_throw(std::overflow_error,"overflow in conversion of real to string");
+			}
+			--exp;
+			if (exp != ::mpfr_exp_t(0) && sign() != 0) {
+				out.push_back('e');
+				out.append(boost::lexical_cast<std::string>(exp));
+			}
+		}
+		/// Construct from a range of decimal characters.
+		/**
+		 * This static method is the counterpart of to_decimal(): it will parse the characters in the range
+		 * [\p begin, \p end), which need not be null-terminated, as done by the constructor from string.
+		 *
+		 * @param[in] begin start of the range.
+		 * @param[in] end end of the range.
+		 * @param[in] prec desired significand precision.
+		 *
+		 * @return the value represented by the characters in the range.
+		 *
+		 * @throws unspecified any exception thrown by the constructor from string or by memory allocation errors in \p std::string.
+		 */
+		static real from_decimal(const char *begin, const char *end, const ::mpfr_prec_t &prec = default_prec)
+		{
+			piranha_assert(begin <= end);
+			// NOTE: MPFR needs a null-terminated string, reuse a thread-local buffer for it.
+			static thread_local std::string buffer;
+			buffer.assign(begin,end);
+			return real(buffer.c_str(),prec);
+		}
+		/// Append the binary representation to a string.
+		/**
+		 * A compact and exact binary representation of \p this will be appended to \p out. The representation
+		 * consists of the precision, the kind of value (finite, zero, NaN or infinity) and its sign and, for finite
+		 * non-zero values, of the binary exponent and of the significand (stripped of trailing zero bits) in the
+		 * format used by piranha::mp_integer::to_binary(). The format does not depend on the platform.
+		 *
+		 * @param[in,out] out output string.
+		 *
+		 * @throws unspecified any exception thrown by memory allocation errors in \p std::string.
+		 */
+		void to_binary(std::string &out) const
+		{
+			detail::append_varint(out,static_cast<unsigned long long>(get_prec()));
+			const unsigned negative = (m_value->_mpfr_sign < 0) ? 4u : 0u;
+			if (is_nan()) {
+				out.push_back(static_cast<char>(2u));
+				return;
+			}
+			if (is_inf()) {
+				out.push_back(static_cast<char>(3u | negative));
+				return;
+			}
+			if (sign() == 0) {
+				out.push_back(static_cast<char>(1u | negative));
+				return;
+			}
+			out.push_back(static_cast<char>(negative));
+			detail::mpz_raii z;
+			::mpfr_exp_t e = ::mpfr_get_z_2exp(&z.m_mpz,m_value);
+			// Strip the trailing zero bits from the significand. The exponent cannot overflow, as the number
+			// of stripped bits is less than the precision.
+			const auto tz = ::mpz_scan1(&z.m_mpz,0u);
+			::mpz_tdiv_q_2exp(&z.m_mpz,&z.m_mpz,tz);
+			e = static_cast< ::mpfr_exp_t>(e + static_cast< ::mpfr_exp_t>(tz));
+			// Zigzag encoding of the exponent.
+			detail::append_varint(out,(e >= 0) ? (static_cast<unsigned long long>(e) << 1u) :
+				((static_cast<unsigned long long>(-(e + 1)) << 1u) | 1u));
+			detail::append_mpz_binary(out,z.m_mpz);
+		}
+		/// Read the binary representation from a range of characters.
+		/**
+		 * This static method is the counterpart of to_binary(): it will decode the value whose binary representation
+		 * starts at \p begin, and advance \p begin past the end of the representation. The decoded value
+		 * is identical to the encoded one, including the precision.
+		 *
+		 * @param[in,out] begin start of the range.
+		 * @param[in] end end of the range.
+		 *
+		 * @return the decoded value.
+		 *
+		 * @throws std::invalid_argument if the range does not contain a valid binary representation.
+		 */
+		static real from_binary(const char *&begin, const char *end)
+		{
+			const auto prec = detail::read_varint(begin,end);
+			if (unlikely(prec > static_cast<unsigned long long>(MPFR_PREC_MAX) || begin == end)) {
+				piranha_throw(std::invalid_argument,"invalid binary encoding");
+			}
+			real retval(0,static_cast< ::mpfr_prec_t>(prec));
+			const auto kind = static_cast<unsigned char>(*begin++);
+			const int sgn = (kind & 4u) ? -1 : 1;
+			switch (kind & 3u) {
+				case 0u:
+				{
+					const auto ze = detail::read_varint(begin,end);
+					if (unlikely((ze >> 1u) > static_cast<unsigned long long>(std::numeric_limits< ::mpfr_exp_t>::max()))) {
+						piranha_throw(std::invalid_argument,"invalid binary encoding");
+					}
+					const auto e = (ze & 1u) ? static_cast< ::mpfr_exp_t>(-static_cast< ::mpfr_exp_t>(ze >> 1u) - 1) :
+						static_cast< ::mpfr_exp_t>(ze >> 1u);
+					detail::mpz_raii z;
+					detail::read_mpz_binary(z.m_mpz,begin,end);
+					::mpfr_set_z_2exp(retval.m_value,&z.m_mpz,e,default_rnd);
+					break;
+				}
+				case 1u:
+					::mpfr_set_zero(retval.m_value,sgn);
+					break;
+				case 2u:
+					::mpfr_set_nan(retval.m_value);
+					break;
+				default:
+					::mpfr_set_inf(retval.m_value,sgn);
+			}
+			return retval;
+		}
 		/// Overload output stream operator for piranha::real.
 		/**
 		 * The output format for finite numbers is normalised scientific notation, where the exponent is signalled by the letter 'e'
@@ -1552,40 +1725,9 @@ class real: public detail::real_base<>
 		 */
 		friend std::ostream &operator<<(std::ostream &os, const real &r)
 		{
-			if (r.is_nan()) {
-				os << "nan";
-				return os;
-			}
-			if (r.is_inf()) {
-				if (r.sign() > 0) {
-					os << "inf";
-				} else {
-					os << "-inf";
-				}
-				return os;
-			}
-			::mpfr_exp_t exp(0);
-			char *cptr = ::mpfr_get_str(nullptr,&exp,10,0,r.m_value,default_rnd);
-			if (unlikely(!cptr)) {
-				piranha_throw(std::overflow_error,"error in conversion of real to rational: the call to the MPFR function failed");
-			}
-			smart_mpfr_str str(cptr,::mpfr_free_str);
-			// Copy into C++ string.
-			std::string cpp_str(str.get());
-			// Insert the radix point.
-			auto it = std::find_if(cpp_str.begin(),cpp_str.end(),[](char c) {return detail::is_digit(c);});
-			if (it != cpp_str.end()) {
-				++it;
-				cpp_str.insert(it,'.');
-				if (exp == std::numeric_limits< ::mpfr_exp_t>::min()) {
-					piranha_throw(std::overflow_error,"overflow in conversion of real to string");
-				}
-				--exp;
-				if (exp != ::mpfr_exp_t(0) && r.sign() != 0) {
-					cpp_str.append(std::string("e") + boost::lexical_cast<std::string>(exp));
-				}
-			}
-			os << cpp_str;
+			std::string tmp;
+			r.to_decimal(tmp);
+			os << tmp;
 			return os;
 		}
 		/// Overload input stream operator for piranha::real.
@@ -132,13 +132,16 @@ class real_trigonometric_kronecker_monomial
 			typedef std::pair<typename eval_type<U>::type,real_trigonometric_kronecker_monomial> pair_type;
 			typedef std::pair<pair_type,pair_type> type;
 		};
-		#define PIRANHA_TMP_TYPE decltype((std::declval<value_type const &>() * math::binomial(std::declval<value_type const &>(),std::declval<value_type const &>())) * \
+		// NOTE: multipliers enter the trigonometric substitution formulae via detail::ka_expo(), so that
+		// 128-bit multipliers are handled as piranha::integer.
+		typedef typename std::decay<decltype(detail::ka_expo(std::declval<const value_type &>()))>::type expo_type;
+		#define PIRANHA_TMP_TYPE decltype((std::declval<expo_type const &>() * math::binomial(std::declval<expo_type const &>(),std::declval<expo_type const &>())) * \
 			(std::declval<const U &>() * std::declval<const U &>()))
 		template <typename U>
 		using t_subs_type = typename std::enable_if<std::is_constructible<U,int>::value &&
 			std::is_default_constructible<U>::value && std::is_assignable<U &, U>::value &&
 			std::is_assignable<U &,decltype(std::declval<const U &>() * std::declval<const U &>())>::value &&
-			is_addable_in_place<PIRANHA_TMP_TYPE,decltype(std::declval<const value_type &>() * std::declval<PIRANHA_TMP_TYPE const &>())>::value &&
+			is_addable_in_place<PIRANHA_TMP_TYPE,decltype(std::declval<const expo_type &>() * std::declval<PIRANHA_TMP_TYPE const &>())>::value &&
 			has_negate<PIRANHA_TMP_TYPE>::value,
 			PIRANHA_TMP_TYPE>::type;
 		#undef PIRANHA_TMP_TYPE
@@ -199,7 +202,7 @@ class real_trigonometric_kronecker_monomial
 		{
 			v_type tmp;
 			for (const auto &x: list) {
-				tmp.push_back(boost::numeric_cast<value_type>(x));
+				tmp.push_back(detail::ka_numeric_cast<value_type>(x));
 			}
 			m_value = ka::encode(tmp);
 		}
@@ -225,7 +228,7 @@ class real_trigonometric_kronecker_monomial
 		{
 			typedef typename std::iterator_traits<Iterator>::value_type it_v_type;
 			v_type tmp;
-			std::transform(start,end,std::back_inserter(tmp),[](const it_v_type &v) {return boost::numeric_cast<value_type>(v);});
+			std::transform(start,end,std::back_inserter(tmp),[](const it_v_type &v) {return detail::ka_numeric_cast<value_type>(v);});
 			m_value = ka::encode(tmp);
 		}
 		/// Constructor from set of symbols.
@@ -321,22 +324,22 @@ class real_trigonometric_kronecker_monomial
 		 * the signs of all multipliers and return \p true.
 		 * Otherwise, \p this will not be modified and \p false will be returned.
 		 * 
+		 * The check and the sign switch are performed directly on the internal integer, without unpacking
+		 * the multipliers.
+		 * 
 		 * @param[in] args reference set of piranha::symbol.
 		 * 
 		 * @return \p true if the monomial was canonicalised, \p false otherwise.
 		 * 
-		 * @throws unspecified any exception thrown by:
-		 * - unpack(),
-		 * - piranha::kronecker_array::encode().
+		 * @throws unspecified any exception thrown by piranha::kronecker_array::first_nonzero_sign().
 		 */
 		bool canonicalise(const symbol_set &args)
 		{
-			auto unpacked = unpack(args);
-			const bool retval = canonicalise_impl(unpacked);
-			if (retval) {
-				m_value = ka::encode(unpacked);
+			if (ka::first_nonzero_sign(m_value,args.size()) < 0) {
+				m_value = static_cast<value_type>(-m_value);
+				return true;
 			}
-			return retval;
+			return false;
 		}
 		/// Compatibility check.
 		/**
@@ -371,19 +374,9 @@ class real_trigonometric_kronecker_monomial
 				return false;
 			}
 			// Now check for the first multiplier.
-			// NOTE: here we have already checked all the conditions that could lead to unpack() throwing, so
+			// NOTE: here we have already checked all the conditions that could lead to first_nonzero_sign() throwing, so
 			// we do not need to put @throw specifications in the doc.
-			const auto unpacked = unpack(args);
-			// We know that s != 0.
-			piranha_assert(unpacked.size() > 0u);
-			for (typename v_type::size_type i = 0u; i < s; ++i) {
-				if (unpacked[i] < value_type(0)) {
-					return false;
-				} else if (unpacked[i] > value_type(0)) {
-					break;
-				}
-			}
-			return true;
+			return ka::first_nonzero_sign(m_value,s) >= 0;
 		}
 		/// Ignorability check.
 		/**
@@ -442,13 +435,12 @@ class real_trigonometric_kronecker_monomial
 		 * 
 		 * @return trigonometric degree of the monomial.
 		 * 
-		 * @throws std::overflow_error if the computation of the degree overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type t_degree(const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_degree<value_type>(tmp,detail::km_safe_adder<value_type>,args);
+			return detail::monomial_degree<value_type>(tmp,detail::km_bounded_adder<value_type>,args);
 		}
 		/// Low trigonometric degree.
 		/**
@@ -475,13 +467,12 @@ class real_trigonometric_kronecker_monomial
 		 * @return the summation of all the multipliers of the monomial corresponding to the symbols in
 		 * \p active_args, or <tt>value_type(0)</tt> if no symbols in \p active_args appear in \p args.
 		 * 
-		 * @throws std::overflow_error if the computation of the degree overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type t_degree(const std::set<std::string> &active_args, const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_partial_degree<value_type>(tmp,detail::km_safe_adder<value_type>,active_args,args);
+			return detail::monomial_partial_degree<value_type>(tmp,detail::km_bounded_adder<value_type>,active_args,args);
 		}
 		/// Partial low trigonometric degree.
 		/**
@@ -504,13 +495,12 @@ class real_trigonometric_kronecker_monomial
 		 * 
 		 * @return trigonometric order of the monomial.
 		 * 
-		 * @throws std::overflow_error if the computation of the order overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type t_order(const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_degree<value_type>(tmp,detail::km_safe_abs_adder<value_type>,args);
+			return detail::monomial_degree<value_type>(tmp,detail::km_bounded_abs_adder<value_type>,args);
 		}
 		/// Low trigonometric order.
 		/**
@@ -537,13 +527,12 @@ class real_trigonometric_kronecker_monomial
 		 * @return the summation of the absolute values of all the multipliers of the monomial corresponding to the symbols in
 		 * \p active_args, or <tt>value_type(0)</tt> if no symbols in \p active_args appear in \p args.
 		 * 
-		 * @throws std::overflow_error if the computation of the order overflows type \p value_type.
 		 * @throws unspecified any exception thrown by unpack().
 		 */
 		value_type t_order(const std::set<std::string> &active_args, const symbol_set &args) const
 		{
 			const auto tmp = unpack(args);
-			return detail::monomial_partial_degree<value_type>(tmp,detail::km_safe_abs_adder<value_type>,active_args,args);
+			return detail::monomial_partial_degree<value_type>(tmp,detail::km_bounded_abs_adder<value_type>,active_args,args);
 		}
 		/// Partial low trigonometric order.
 		/**
@@ -571,6 +560,10 @@ class real_trigonometric_kronecker_monomial
 		 * reversed and the value of \p sign_plus (resp. \p sign_minus) will be set to \p true; otherwise, the value of \p sign_plus (resp. \p sign_minus)
 		 * will be set to \p false.
 		 * 
+		 * If the multipliers of the results are guaranteed to be within the limits of the Kronecker codification,
+		 * the codes of the results are computed directly by adding and subtracting the codes of the operands,
+		 * and the multipliers are not encoded back.
+		 * 
 		 * @param[out] retval_plus monomial containing the sum of the multipliers of \p this and \p other.
 		 * @param[out] retval_minus monomial containing the difference of the multipliers of \p this and \p other.
 		 * @param[in] other multiplicand.
@@ -591,6 +584,40 @@ class real_trigonometric_kronecker_monomial
 			sign_minus = false;
 			const auto size = args.size();
 			const auto tmp1 = unpack(args), tmp2 = other.unpack(args);
+			const bool f = (get_flavour() == other.get_flavour());
+			// Fast path: if |a_i| + |b_i| <= M_i for all i, both a_i + b_i and a_i - b_i are within the limits of the
+			// codification. As the codification is linear, the codes of the results are then the sum and the difference
+			// of the codes of the operands, and the canonicalisation amounts to negating the codes.
+			// NOTE: unpack() succeeded, so here size is a valid index in the limits vector.
+			const auto &minmax_vec = std::get<0u>(ka::get_limits()[size]);
+			int s_plus = 0, s_minus = 0;
+			typename v_type::size_type i = 0u;
+			for (; i < size; ++i) {
+				const value_type a = tmp1[i], b = tmp2[i];
+				// NOTE: 2 * M_i is always representable, see kronecker_array.
+				const value_type abs_sum = static_cast<value_type>((a >= value_type(0) ? a : static_cast<value_type>(-a)) +
+					(b >= value_type(0) ? b : static_cast<value_type>(-b)));
+				if (unlikely(abs_sum > minmax_vec[i])) {
+					break;
+				}
+				if (!s_plus && a != static_cast<value_type>(-b)) {
+					s_plus = (a > static_cast<value_type>(-b)) ? 1 : -1;
+				}
+				if (!s_minus && a != b) {
+					s_minus = (a > b) ? 1 : -1;
+				}
+			}
+			if (likely(i == size)) {
+				const value_type re_plus = static_cast<value_type>(m_value + other.m_value),
+					re_minus = static_cast<value_type>(m_value - other.m_value);
+				sign_plus = (s_plus < 0);
+				sign_minus = (s_minus < 0);
+				retval_plus.m_value = sign_plus ? static_cast<value_type>(-re_plus) : re_plus;
+				retval_minus.m_value = sign_minus ? static_cast<value_type>(-re_minus) : re_minus;
+				retval_plus.m_flavour = f;
+				retval_minus.m_flavour = f;
+				return;
+			}
 			v_type result_plus, result_minus;
 			for (typename v_type::size_type i = 0u; i < size; ++i) {
 				result_plus.push_back(tmp1[i]);
@@ -609,12 +636,16 @@ class real_trigonometric_kronecker_monomial
 			const auto re_plus = ka::encode(result_plus), re_minus = ka::encode(result_minus);
 			retval_plus.m_value = re_plus;
 			retval_minus.m_value = re_minus;
-			const bool f = (get_flavour() == other.get_flavour());
 			retval_plus.m_flavour = f;
 			retval_minus.m_flavour = f;
 		}
 		/// Hash value.
 		/**
+		 * If \p T is wider than \p std::size_t (e.g., the 128-bit integer), the cast folds the internal integer
+		 * modulo \f$ 2^N \f$, \f$ N \f$ being the bit width of \p std::size_t. Contrary to other folding schemes
+		 * (e.g., xoring the high and low halves), this preserves the additivity of the Kronecker codes, which is exploited by
+		 * the series multipliers to predict the destination bucket of a product.
+		 * 
 		 * @return the internal integer instance, cast to \p std::size_t.
 		 */
 		std::size_t hash() const
@@ -693,7 +724,7 @@ class real_trigonometric_kronecker_monomial
 					if (tmp[i] == m_one) {
 						os << "-";
 					} else if (tmp[i] != one) {
-						os << detail::prepare_for_print(tmp[i]) << '*';
+						os << detail::prepare_for_print(detail::ka_expo(tmp[i])) << '*';
 					}
 					// Finally, print name of variable.
 					os << args[i].get_name();
@@ -737,7 +768,7 @@ class real_trigonometric_kronecker_monomial
 					if (tmp[i] == m_one) {
 						os << "-";
 					} else if (tmp[i] != one) {
-						os << static_cast<long long>(tmp[i]);
+						os << detail::prepare_for_print(detail::ka_expo(tmp[i]));
 					}
 					// Finally, print name of variable.
 					os << "{" << args[i].get_name() << "}";
@@ -770,7 +801,7 @@ class real_trigonometric_kronecker_monomial
 			auto v = unpack(args);
 			for (min_int<decltype(args.size()),decltype(v.size())> i = 0u; i < args.size(); ++i) {
 				if (args[i] == s && !math::is_zero(v[i])) {
-					integer tmp_n(v[i]);
+					integer tmp_n(detail::ka_to_integer(v[i]));
 					real_trigonometric_kronecker_monomial tmp_m(*this);
 					// Flip the flavour.
 					tmp_m.set_flavour(!get_flavour());
@@ -807,7 +838,7 @@ class real_trigonometric_kronecker_monomial
 			auto v = unpack(args);
 			for (min_int<decltype(args.size()),typename v_type::size_type> i = 0u; i < args.size(); ++i) {
 				if (args[i] == s && !math::is_zero(v[i])) {
-					integer tmp_n(v[i]);
+					integer tmp_n(detail::ka_to_integer(v[i]));
 					real_trigonometric_kronecker_monomial tmp_m(*this);
 					// Flip the flavour.
 					tmp_m.set_flavour(!get_flavour());
@@ -996,7 +1027,7 @@ class real_trigonometric_kronecker_monomial
 			// Absolute value of the multiplier.
 			const value_type abs_n = (n >= 0) ? n : static_cast<value_type>(-n);
 			// Prepare the powers of c and s to be used in the multiple angles formulae.
-			std::unordered_map<value_type,U> c_map, s_map;
+			std::unordered_map<value_type,U,detail::ka_hasher> c_map, s_map;
 			c_map[0] = U(1);
 			s_map[0] = U(1);
 			for (value_type k(0); k < abs_n; ++k) {
@@ -1004,17 +1035,18 @@ class real_trigonometric_kronecker_monomial
 				s_map[k + value_type(1)] = s_map[k] * s;
 			}
 			// Init with the first element in the summation.
-			res_type cos_nx((cos_phase(abs_n) * math::binomial(abs_n,value_type(0))) * (c_map[value_type(0)] * s_map[abs_n])),
-				sin_nx((sin_phase(abs_n) * math::binomial(abs_n,value_type(0))) * (c_map[value_type(0)] * s_map[abs_n]));
+			const expo_type abs_n_e(detail::ka_expo(abs_n));
+			res_type cos_nx((detail::ka_expo(cos_phase(abs_n)) * math::binomial(abs_n_e,expo_type(0))) * (c_map[value_type(0)] * s_map[abs_n])),
+				sin_nx((detail::ka_expo(sin_phase(abs_n)) * math::binomial(abs_n_e,expo_type(0))) * (c_map[value_type(0)] * s_map[abs_n]));
 			for (value_type k(0); k < abs_n; ++k) {
 				const value_type p = abs_n - (k + value_type(1));
 				piranha_assert(p >= value_type(0));
 				// NOTE: here the type is slightly different from the decltype() that determines the return type, but as long
 				// as binomial(value_type,value_type) returns integer there will be no difference because of the
 				// left-to-right associativity of multiplication.
-				res_type tmp(math::binomial(abs_n,k + value_type(1)) * (c_map[k + value_type(1)] * s_map[p]));
-				cos_nx += cos_phase(p) * tmp;
-				sin_nx += sin_phase(p) * tmp;
+				res_type tmp(math::binomial(abs_n_e,detail::ka_expo(static_cast<value_type>(k + value_type(1)))) * (c_map[k + value_type(1)] * s_map[p]));
+				cos_nx += detail::ka_expo(cos_phase(p)) * tmp;
+				sin_nx += detail::ka_expo(sin_phase(p)) * tmp;
 			}
 			// Change sign as necessary.
 			if (abs_n != n) {
@@ -28,6 +28,7 @@
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/math/special_functions/trunc.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <iostream>
@@ -528,11 +529,12 @@ class series: series_binary_operators, detail::series_tag
 				// Let's deal with the first series.
 				auto merge = m_symbol_set.merge(other.m_symbol_set);
 				if (merge != m_symbol_set) {
-					operator=(merge_args(merge));
+					in_place_merge_args(merge);
 				}
 				// Second series.
 				if (merge != other.m_symbol_set) {
-					auto other_copy = other.merge_args(merge);
+					typedef series<typename std::decay<T>::type::term_type,typename std::decay<T>::type> base_type2;
+					auto other_copy = base_type2::merge_args_impl(std::forward<T>(other),merge);
 					merge_terms<Sign>(std::move(other_copy));
 				} else {
 					merge_terms<Sign>(std::forward<T>(other));
@@ -622,12 +624,12 @@ class series: series_binary_operators, detail::series_tag
 				auto merge = m_symbol_set.merge(other.m_symbol_set);
 				piranha_assert(merge == other.m_symbol_set.merge(m_symbol_set));
 				if (merge != m_symbol_set) {
-					operator=(merge_args(merge));
+					in_place_merge_args(merge);
 				}
 				// Second series.
 				if (merge != other.m_symbol_set) {
 					typename std::decay<T>::type other_copy;
-					static_cast<base_type2 &>(other_copy) = other.merge_args(merge);
+					static_cast<base_type2 &>(other_copy) = base_type2::merge_args_impl(std::forward<T>(other),merge);
 					static_assert(std::is_same<base_type2,decltype(other.merge_args(merge))>::value,"Inconsistent type.");
 					operator=(multiply_by_series(other_copy));
 				} else {
@@ -706,43 +708,47 @@ class series: series_binary_operators, detail::series_tag
 			piranha_assert(start != end);
 			const auto limit = settings::get_max_term_output();
 			size_type count = 0u;
-			std::ostringstream oss;
+			// NOTE: the streams used for the printing of coefficients and keys, and the strings extracted from them,
+			// are shared across terms, as the construction of a stream for each term is expensive.
+			std::ostringstream oss_cf, oss_key;
+			std::string str, str_cf, str_key;
 			auto it = start;
 			for (; it != end;) {
 				if (limit && count == limit) {
 					break;
 				}
-				std::ostringstream oss_cf;
+				oss_cf.str(std::string());
+				oss_cf.clear();
 				if (TexMode) {
 					print_tex_coefficient(oss_cf,it->m_cf);
 				} else {
 					print_coefficient(oss_cf,it->m_cf);
 				}
-				auto str_cf = oss_cf.str();
-				std::ostringstream oss_key;
+				str_cf = oss_cf.str();
+				oss_key.str(std::string());
+				oss_key.clear();
 				if (TexMode) {
 					it->m_key.print_tex(oss_key,args);
 				} else {
 					it->m_key.print(oss_key,args);
 				}
-				auto str_key = oss_key.str();
+				str_key = oss_key.str();
 				if (str_cf == "1" && !str_key.empty()) {
-					str_cf = "";
+					str_cf.clear();
 				} else if (str_cf == "-1" && !str_key.empty()) {
 					str_cf = "-";
 				}
-				oss << str_cf;
-				if (str_cf != "" && str_cf != "-" && !str_key.empty() && !TexMode) {
-					oss << "*";
+				str += str_cf;
+				if (!str_cf.empty() && str_cf != "-" && !str_key.empty() && !TexMode) {
+					str += '*';
 				}
-				oss << str_key;
+				str += str_key;
 				++it;
 				if (it != end) {
-					oss << "+";
+					str += '+';
 				}
 				++count;
 			}
-			auto str = oss.str();
 			// If we reached the limit without printing all terms in the series, print the ellipsis.
 			if (limit && count == limit && it != end) {
 				if (TexMode) {
@@ -751,15 +757,16 @@ class series: series_binary_operators, detail::series_tag
 					str += "...";
 				}
 			}
-			std::string::size_type index = 0u;
-			while (true) {
-				index = str.find("+-",index);
-				if (index == std::string::npos) {
-					break;
+			// Replace all occurrences of "+-" with "-", in a single pass.
+			std::string::size_type j = 0u;
+			for (std::string::size_type i = 0u; i < str.size(); ++i) {
+				if (str[i] == '+' && i + 1u < str.size() && str[i + 1u] == '-') {
+					continue;
 				}
-				str.replace(index,2u,"-");
-				++index;
+				str[j] = str[i];
+				++j;
 			}
+			str.resize(j);
 			os << str;
 			return os;
 		}
@@ -773,16 +780,66 @@ class series: series_binary_operators, detail::series_tag
 		// Merge arguments using new_ss as new symbol set.
 		series merge_args(const symbol_set &new_ss) const
 		{
-			piranha_assert(new_ss.size() > m_symbol_set.size());
-			piranha_assert(std::includes(new_ss.begin(),new_ss.end(),m_symbol_set.begin(),m_symbol_set.end()));
+			return merge_args_impl(*this,new_ss);
+		}
+		// Merge arguments in place, moving the coefficients into the new series. In case of errors,
+		// the series is cleared out.
+		void in_place_merge_args(const symbol_set &new_ss)
+		{
+			operator=(merge_args_impl(std::move(*this),new_ss));
+		}
+		// Clear out a series whose coefficients were moved away, so that no terms with moved-from coefficients
+		// survive (e.g., empty series coefficients would be ignorable).
+		template <typename S>
+		static void clear_moved_from(S &s, const std::true_type &)
+		{
+			s.m_container.clear();
+		}
+		template <typename S>
+		static void clear_moved_from(S &, const std::false_type &) {}
+		// NOTE: the coefficients are moved out of s if s is an rvalue, and s is cleared out afterwards (also in case of errors).
+		// The merged keys are all distinct, so the terms can be placed directly in a table of adequate size, bypassing the
+		// lookups and the load factor checks of insert().
+		template <typename S>
+		static series merge_args_impl(S &&s, const symbol_set &new_ss)
+		{
+			typedef std::integral_constant<bool,!std::is_lvalue_reference<S>::value &&
+				!std::is_const<typename std::remove_reference<S>::type>::value> move_cf;
+			try {
+				auto retval = merge_args_terms(s,new_ss,move_cf());
+				clear_moved_from(s,move_cf());
+				return retval;
+			} catch (...) {
+				clear_moved_from(s,move_cf());
+				throw;
+			}
+		}
+		template <typename S, typename MoveCf>
+		static series merge_args_terms(S &s, const symbol_set &new_ss, const MoveCf &)
+		{
+			piranha_assert(new_ss.size() > s.m_symbol_set.size());
+			piranha_assert(std::includes(new_ss.begin(),new_ss.end(),s.m_symbol_set.begin(),s.m_symbol_set.end()));
 			typedef typename term_type::cf_type cf_type;
 			typedef typename term_type::key_type key_type;
+			typedef typename std::conditional<MoveCf::value,cf_type &&,const cf_type &>::type cf_ref_type;
 			series retval;
 			retval.m_symbol_set = new_ss;
-			for (auto it = m_container.begin(); it != m_container.end(); ++it) {
-				cf_type new_cf(it->m_cf);
-				key_type new_key(it->m_key.merge_args(m_symbol_set,new_ss));
-				retval.insert(term_type(std::move(new_cf),std::move(new_key)));
+			if (s.m_container.empty()) {
+				return retval;
+			}
+			retval.m_container.rehash(boost::numeric_cast<size_type>(std::ceil(static_cast<double>(s.m_container.size()) /
+				retval.m_container.max_load_factor())));
+			for (auto it = s.m_container.begin(); it != s.m_container.end(); ++it) {
+				term_type new_term(cf_type(static_cast<cf_ref_type>(it->m_cf)),key_type(it->m_key.merge_args(s.m_symbol_set,new_ss)));
+				if (unlikely(!new_term.is_compatible(new_ss))) {
+					piranha_throw(std::invalid_argument,"cannot insert incompatible term");
+				}
+				if (unlikely(new_term.is_ignorable(new_ss))) {
+					continue;
+				}
+				const auto bucket_idx = retval.m_container._bucket(new_term);
+				retval.m_container._unique_insert(std::move(new_term),bucket_idx);
+				retval.m_container._update_size(retval.m_container.size() + size_type(1u));
 			}
 			return retval;
 		}
@@ -34,6 +34,7 @@
 #include "config.hpp"
 #include "detail/small_vector_fwd.hpp"
 #include "detail/vector_hasher.hpp"
+#include "detail/vector_kernels.hpp"
 #include "exceptions.hpp"
 #include "memory.hpp"
 #include "static_vector.hpp"
@@ -750,26 +751,7 @@ class small_vector
 			>::type>
 		bool operator==(const small_vector &other) const
 		{
-			// NOTE: it seems like in C++14 the check on equal sizes is embedded in std::equal
-			// when using the new algorithm signature:
-			// http://en.cppreference.com/w/cpp/algorithm/equal
-			// Just keep it in mind for the future.
-			const unsigned mask = static_cast<unsigned>(m_union.is_static()) +
-				(static_cast<unsigned>(other.m_union.is_static()) << 1u);
-			switch (mask)
-			{
-				case 0u:
-					return m_union.g_dy().size() == other.m_union.g_dy().size() &&
-						std::equal(m_union.g_dy().begin(),m_union.g_dy().end(),other.m_union.g_dy().begin());
-				case 1u:
-					return m_union.g_st().size() == other.m_union.g_dy().size() &&
-						std::equal(m_union.g_st().begin(),m_union.g_st().end(),other.m_union.g_dy().begin());
-				case 2u:
-					return m_union.g_dy().size() == other.m_union.g_st().size() &&
-						std::equal(m_union.g_dy().begin(),m_union.g_dy().end(),other.m_union.g_st().begin());
-			}
-			return m_union.g_st().size() == other.m_union.g_st().size() &&
-				std::equal(m_union.g_st().begin(),m_union.g_st().end(),other.m_union.g_st().begin());
+			return equal_impl(other,detail::vk_enabled<value_type>());
 		}
 		/// Inequality operator.
 		/**
@@ -881,6 +863,36 @@ class small_vector
 			std::transform(begin(),end(),other.begin(),retval.begin(),adder<value_type>());
 		}
 	private:
+		// Equality: integral types are compared via the branch-free kernel on the contiguous
+		// storage, which does not depend on the static/dynamic state of the vectors.
+		bool equal_impl(const small_vector &other, const std::true_type &) const
+		{
+			const auto s = size();
+			return s == other.size() && detail::vector_equal(begin(),other.begin(),static_cast<std::size_t>(s));
+		}
+		bool equal_impl(const small_vector &other, const std::false_type &) const
+		{
+			// NOTE: it seems like in C++14 the check on equal sizes is embedded in std::equal
+			// when using the new algorithm signature:
+			// http://en.cppreference.com/w/cpp/algorithm/equal
+			// Just keep it in mind for the future.
+			const unsigned mask = static_cast<unsigned>(m_union.is_static()) +
+				(static_cast<unsigned>(other.m_union.is_static()) << 1u);
+			switch (mask)
+			{
+				case 0u:
+					return m_union.g_dy().size() == other.m_union.g_dy().size() &&
+						std::equal(m_union.g_dy().begin(),m_union.g_dy().end(),other.m_union.g_dy().begin());
+				case 1u:
+					return m_union.g_st().size() == other.m_union.g_dy().size() &&
+						std::equal(m_union.g_st().begin(),m_union.g_st().end(),other.m_union.g_dy().begin());
+				case 2u:
+					return m_union.g_dy().size() == other.m_union.g_st().size() &&
+						std::equal(m_union.g_dy().begin(),m_union.g_dy().end(),other.m_union.g_st().begin());
+			}
+			return m_union.g_st().size() == other.m_union.g_st().size() &&
+				std::equal(m_union.g_st().begin(),m_union.g_st().end(),other.m_union.g_st().begin());
+		}
 		// NOTE: need this to silence warnings when operating on short ints: they will get
 		// promoted to int during addition, hence resulting in a warning when casting back down
 		// to short int on return.
@@ -27,6 +27,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "config.hpp"
@@ -59,7 +60,8 @@ std::set<std::string> base_symbol<T>::m_symbol_list;
  * referring to the same underlying object.
  * 
  * The methods of this class, unless specified otherwise, are thread-safe: it is possible to create, access and operate on objects of this class
- * concurrently from multiple threads
+ * concurrently from multiple threads. The global list is protected by a mutex, but each thread caches the names it has already looked up,
+ * so that repeated constructions of symbols with the same name do not require locking.
  * 
  * \section exception_safety Exception safety guarantee
  * 
@@ -157,6 +159,20 @@ class symbol: private detail::base_symbol<>
 		}
 	private:
 		static std::string const *get_pointer(const std::string &name)
+		{
+			// NOTE: the pointers into the global list are never invalidated, as symbols are never
+			// removed from the list. Hence each thread can keep a private cache of the names it has
+			// already looked up, which can be accessed without locking.
+			static thread_local std::unordered_map<std::string,std::string const *> local_cache;
+			const auto l_it = local_cache.find(name);
+			if (l_it != local_cache.end()) {
+				return l_it->second;
+			}
+			std::string const *retval = get_pointer_impl(name);
+			local_cache.emplace(name,retval);
+			return retval;
+		}
+		static std::string const *get_pointer_impl(const std::string &name)
 		{
 			std::lock_guard<std::mutex> lock(m_mutex);
 			auto it = m_symbol_list.find(name);
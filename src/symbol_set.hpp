@@ -24,7 +24,9 @@
 #include <algorithm>
 #include <initializer_list>
 #include <iterator>
+#include <set>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "config.hpp"
@@ -77,6 +79,95 @@ class symbol_set
 		typedef std::vector<symbol>::size_type size_type;
 		/// Const iterator.
 		typedef std::vector<symbol>::const_iterator const_iterator;
+		/// Positions class.
+		/**
+		 * This is a small utility class that can be used to determine the positions,
+		 * in a piranha::symbol_set \p a, of the symbols whose names belong to a set of names \p b.
+		 * The positions are stored in ascending order.
+		 *
+		 * The purpose of this class is to resolve the names of the symbols once, so that the positions can
+		 * then be used in operations repeated for each term of a series (e.g., the computation of the partial degree).
+		 */
+		class positions
+		{
+			public:
+				/// Value type.
+				/**
+				 * The positions are represented using the size type of piranha::symbol_set.
+				 */
+				typedef size_type value_type;
+				/// Const iterator.
+				typedef std::vector<value_type>::const_iterator const_iterator;
+				/// Constructor.
+				/**
+				 * After construction, \p this will contain the positions, in \p a, of the symbols whose
+				 * names appear in \p b. Names in \p b not appearing in \p a are ignored.
+				 *
+				 * @param[in] a first piranha::symbol_set.
+				 * @param[in] b set of names.
+				 *
+				 * @throws unspecified any exception thrown by memory allocation errors in \p std::vector.
+				 */
+				explicit positions(const symbol_set &a, const std::set<std::string> &b)
+				{
+					// NOTE: both sets are sorted according to the names of the symbols, so we can
+					// resolve the positions with a single merge-like pass.
+					auto it_b = b.begin();
+					for (size_type i = 0u; i < a.size() && it_b != b.end(); ++i) {
+						const auto &name = a[i].get_name();
+						while (it_b != b.end() && *it_b < name) {
+							++it_b;
+						}
+						if (it_b != b.end() && *it_b == name) {
+							m_values.push_back(i);
+							++it_b;
+						}
+					}
+				}
+				/// Deleted copy constructor.
+				positions(const positions &) = delete;
+				/// Deleted move constructor.
+				positions(positions &&) = delete;
+				/// Deleted copy assignment operator.
+				positions &operator=(const positions &) = delete;
+				/// Deleted move assignment operator.
+				positions &operator=(positions &&) = delete;
+				/// Begin iterator.
+				/**
+				 * @return iterator to the beginning of the set of positions.
+				 */
+				const_iterator begin() const
+				{
+					return m_values.begin();
+				}
+				/// End iterator.
+				/**
+				 * @return iterator to the end of the set of positions.
+				 */
+				const_iterator end() const
+				{
+					return m_values.end();
+				}
+				/// Size.
+				/**
+				 * @return number of positions stored in \p this.
+				 */
+				std::vector<value_type>::size_type size() const
+				{
+					return m_values.size();
+				}
+				/// Last element.
+				/**
+				 * @return a const reference to the last element.
+				 */
+				const value_type &back() const
+				{
+					piranha_assert(m_values.size());
+					return m_values.back();
+				}
+			private:
+				std::vector<value_type> m_values;
+		};
 		/// Defaulted default constructor.
 		/**
 		 * Will construct an empty set.
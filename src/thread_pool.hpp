@@ -36,10 +36,10 @@
 #include <vector>
 
 #include "config.hpp"
+#include "detail/mp_integer_fwd.hpp"
 #include "detail/mpfr.hpp"
 #include "exceptions.hpp"
-#include "math.h"
-#include "mp_integer.hpp"
+#include "math.hpp"
 #include "runtime_info.hpp"
 #include "thread_management.hpp"
 #include "type_traits.hpp"
@@ -306,8 +306,10 @@ class thread_pool: private detail::thread_pool_base<>
 		 * @throws std::invalid_argument if \p min_work_per_thread is zero.
 		 * @throws unspecified any exception thrown by threading primitives.
 		 */
+		// NOTE: piranha::integer is referred to via its forward declaration, so that mp_integer.hpp can depend
+		// (via the tracing and settings machinery) on this header.
 		template <typename Int, typename = typename std::enable_if<(std::is_integral<Int>::value && std::is_unsigned<Int>::value) ||
-			std::is_same<Int,integer>::value>::type>
+			std::is_same<Int,mp_integer<0>>::value>::type>
 		static unsigned use_threads(const Int &work_size, const Int &min_work_per_thread)
 		{
 			// Check input param.
@@ -39,6 +39,7 @@ struct base_tuning
 {
 	static std::atomic<bool>	s_parallel_memory_set;
 	static std::atomic<unsigned>	s_mult_block_size;
+	static std::atomic<bool>	s_crt_multiplication;
 };
 
 template <typename T>
@@ -47,6 +48,9 @@ std::atomic<bool> base_tuning<T>::s_parallel_memory_set(true);
 template <typename T>
 std::atomic<unsigned> base_tuning<T>::s_mult_block_size(256u);
 
+template <typename T>
+std::atomic<bool> base_tuning<T>::s_crt_multiplication(false);
+
 }
 
 /// Performance tuning.
@@ -113,6 +117,37 @@ class tuning: private detail::base_tuning<>
 			}
 			s_mult_block_size.store(size);
 		}
+		/// Get the \p crt_multiplication flag.
+		/**
+		 * When this flag is \p true, the multiplication of polynomials with piranha::mp_integer coefficients and
+		 * piranha::kronecker_monomial monomials is performed via multi-modular arithmetic: the operands are reduced modulo a few
+		 * word-sized primes (enough to represent the coefficients of the result, according to a bound computed from the operands),
+		 * the products modulo each prime are computed in parallel with piranha::modular_integer coefficients, and the
+		 * integral coefficients of the result are finally reconstructed via the Chinese remainder theorem.
+		 *
+		 * Each modular product is much cheaper than the corresponding product with piranha::mp_integer coefficients, but
+		 * the total work grows linearly with the number of primes (e.g., five primes are needed for the coefficients
+		 * of Fateman's second benchmark). This mode is thus profitable only when the independent modular products can be run
+		 * concurrently on multiple cores.
+		 *
+		 * The default value of this flag is \p false.
+		 *
+		 * @return current value of the \p crt_multiplication flag.
+		 */
+		static bool get_crt_multiplication()
+		{
+			return s_crt_multiplication.load();
+		}
+		/// Set the \p crt_multiplication flag.
+		/**
+		 * @see piranha::tuning::get_crt_multiplication() for an explanation of the meaning of this flag.
+		 *
+		 * @param[in] flag desired value for the \p crt_multiplication flag.
+		 */
+		static void set_crt_multiplication(bool flag)
+		{
+			s_crt_multiplication.store(flag);
+		}
 
 };
 
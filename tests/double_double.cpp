@@ -0,0 +1,334 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "../src/double_double.hpp"
+
+#define BOOST_TEST_MODULE double_double_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "../src/environment.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/math.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/poisson_series.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/real.hpp"
+#include "../src/type_traits.hpp"
+
+static std::mt19937 rng;
+static const int ntries = 1000;
+
+using namespace piranha;
+
+// Check that the distance between a double_double and a real is within tol ulps of the
+// double-double format, relative to scale (or to r itself, by default).
+static bool dd_close(const double_double &x, const real &r, double tol = 8., real scale = real{})
+{
+	if (scale.sign() == 0) {
+		scale = r.abs();
+	}
+	if (scale.sign() == 0) {
+		return std::abs(x.hi()) <= std::ldexp(tol,-106);
+	}
+	const real diff = (static_cast<real>(x) - r) / scale;
+	return std::abs(static_cast<double>(diff)) <= std::ldexp(tol,-106);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_constructors_test)
+{
+	environment env;
+	BOOST_CHECK_EQUAL(double_double{}.hi(),0.);
+	BOOST_CHECK_EQUAL(double_double{}.lo(),0.);
+	BOOST_CHECK_EQUAL(double_double{1.5}.hi(),1.5);
+	BOOST_CHECK_EQUAL(double_double{1.5f}.hi(),1.5);
+	BOOST_CHECK_EQUAL(double_double{-3}.hi(),-3.);
+	BOOST_CHECK_EQUAL(double_double{char(3)}.hi(),3.);
+	BOOST_CHECK_EQUAL(double_double{3u}.hi(),3.);
+	BOOST_CHECK_EQUAL(double_double{true}.hi(),1.);
+	// Integers that do not fit in the high part.
+	const long long big = (1ll << 60) + 1;
+	BOOST_CHECK_EQUAL(double_double{big}.hi(),std::ldexp(1.,60));
+	BOOST_CHECK_EQUAL(double_double{big}.lo(),1.);
+	BOOST_CHECK_EQUAL(static_cast<long long>(double_double{big}),big);
+	BOOST_CHECK_EQUAL(static_cast<unsigned long long>(double_double{std::numeric_limits<unsigned long long>::max()}),
+		std::numeric_limits<unsigned long long>::max());
+	const integer n = math::pow(integer(2),100);
+	BOOST_CHECK_EQUAL(static_cast<integer>(double_double{n + 1}),n + 1);
+	BOOST_CHECK_EQUAL(static_cast<integer>(double_double{-n - 1}),-n - 1);
+	// Rationals and strings.
+	BOOST_CHECK(dd_close(double_double{rational(1,3)},real{rational(1,3),200},1.));
+	BOOST_CHECK(dd_close(double_double{"0.1"},real{"0.1",200},1.));
+	BOOST_CHECK(dd_close(double_double{std::string("-1.23e-7")},real{"-1.23e-7",200},1.));
+	BOOST_CHECK_THROW(double_double{"foo"},std::invalid_argument);
+	BOOST_CHECK(dd_close(double_double{real{"0.1",200}},real{"0.1",200},1.));
+	// Long double.
+	if (std::numeric_limits<long double>::digits > 53) {
+		const long double ld = 1.l + std::numeric_limits<long double>::epsilon();
+		BOOST_CHECK_EQUAL(static_cast<long double>(double_double{ld}),ld);
+	}
+	// Non-finite values.
+	BOOST_CHECK(double_double{std::numeric_limits<double>::infinity()}.is_inf());
+	BOOST_CHECK(double_double{std::numeric_limits<double>::quiet_NaN()}.is_nan());
+	// Assignment.
+	double_double d;
+	d = 5;
+	BOOST_CHECK_EQUAL(d,5);
+	d = rational(1,2);
+	BOOST_CHECK_EQUAL(d,0.5);
+	d = real{"0.25"};
+	BOOST_CHECK_EQUAL(d,0.25);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_conversion_test)
+{
+	double_double d{rational(7,2)};
+	BOOST_CHECK_EQUAL(static_cast<int>(d),3);
+	BOOST_CHECK_EQUAL(static_cast<integer>(-d),-3);
+	BOOST_CHECK_EQUAL(static_cast<double>(d),3.5);
+	BOOST_CHECK_EQUAL(static_cast<rational>(d),rational(7,2));
+	BOOST_CHECK_EQUAL(static_cast<real>(d),real{"3.5"});
+	BOOST_CHECK(static_cast<bool>(d));
+	BOOST_CHECK(!static_cast<bool>(double_double{}));
+	BOOST_CHECK_THROW(static_cast<integer>(double_double{std::numeric_limits<double>::infinity()}),std::overflow_error);
+	// Truncation when the low part has the opposite sign of the high part.
+	double_double e{math::pow(integer(2),60)};
+	e -= 0.5;
+	BOOST_CHECK_EQUAL(static_cast<integer>(e),math::pow(integer(2),60) - 1);
+	BOOST_CHECK_EQUAL(static_cast<integer>(-e),-math::pow(integer(2),60) + 1);
+	BOOST_CHECK_EQUAL(static_cast<integer>(double_double{-2.5}),-2);
+	// Conversion to rational is exact.
+	const double_double third{rational(1,3)};
+	BOOST_CHECK_EQUAL(static_cast<rational>(third),rational(third.hi()) + rational(third.lo()));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_arithmetic_test)
+{
+	std::uniform_real_distribution<double> dist(-1E3,1E3);
+	for (int i = 0; i < ntries; ++i) {
+		const double_double a = double_double{dist(rng)} / double_double{dist(rng)},
+			b = double_double{dist(rng)} / double_double{dist(rng)};
+		const real ra{static_cast<rational>(a),300}, rb{static_cast<rational>(b),300};
+		BOOST_CHECK(dd_close(a + b,ra + rb,8.,ra.abs() + rb.abs()));
+		BOOST_CHECK(dd_close(a - b,ra - rb,8.,ra.abs() + rb.abs()));
+		BOOST_CHECK(dd_close(a * b,ra * rb));
+		BOOST_CHECK(dd_close(a / b,ra / rb));
+		double_double c(a);
+		c.multiply_accumulate(a,b);
+		BOOST_CHECK(dd_close(c,ra + ra * rb,8.,ra.abs() + (ra * rb).abs()));
+		c = a;
+		c *= b.hi();
+		BOOST_CHECK(dd_close(c,ra * real{b.hi(),300}));
+	}
+	// The classic example of a value that double cannot represent.
+	double_double x{1.};
+	x += std::ldexp(1.,-80);
+	BOOST_CHECK_EQUAL(x.hi(),1.);
+	BOOST_CHECK_EQUAL(x.lo(),std::ldexp(1.,-80));
+	x -= 1;
+	BOOST_CHECK_EQUAL(x,std::ldexp(1.,-80));
+	// Interop.
+	BOOST_CHECK((std::is_same<decltype(double_double{} + 1),double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(integer{} * double_double{}),double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(double_double{} / rational{}),double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(real{} - double_double{}),real>::value));
+	BOOST_CHECK((std::is_same<decltype(double_double{} + real{}),real>::value));
+	BOOST_CHECK(dd_close(double_double{1} / 3 * 3,real{1}));
+	BOOST_CHECK_EQUAL(2 * double_double{3},6);
+	BOOST_CHECK_EQUAL(rational(1,2) + double_double{0.5},1);
+	int n = 4;
+	n += double_double{1.5};
+	BOOST_CHECK_EQUAL(n,5);
+	real r{1};
+	r /= double_double{4};
+	BOOST_CHECK_EQUAL(r,0.25);
+	double_double y{1};
+	y *= integer(3);
+	y /= real{2};
+	BOOST_CHECK_EQUAL(y,1.5);
+	BOOST_CHECK_EQUAL(y++,1.5);
+	BOOST_CHECK_EQUAL(y,2.5);
+	BOOST_CHECK_EQUAL(--y,1.5);
+	BOOST_CHECK_EQUAL(-y,-1.5);
+	BOOST_CHECK_EQUAL(+y,1.5);
+	// Division by zero.
+	BOOST_CHECK((double_double{1} / 0).is_inf());
+	BOOST_CHECK((double_double{0} / 0).is_nan());
+	BOOST_CHECK((double_double{std::numeric_limits<double>::infinity()} * 2).is_inf());
+	BOOST_CHECK_EQUAL((double_double{std::numeric_limits<double>::infinity()} * 2).lo(),0.);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_comparison_test)
+{
+	double_double x{1.};
+	x += std::ldexp(1.,-80);
+	BOOST_CHECK(x > 1);
+	BOOST_CHECK(1 < x);
+	BOOST_CHECK(x >= 1.);
+	BOOST_CHECK(x != 1);
+	BOOST_CHECK(x <= x);
+	BOOST_CHECK(-x < double_double{-1});
+	BOOST_CHECK((x > real{1,200}));
+	BOOST_CHECK(real{2} > x);
+	BOOST_CHECK(x == x);
+	BOOST_CHECK(double_double{2} == integer(2));
+	BOOST_CHECK(!(double_double{std::numeric_limits<double>::quiet_NaN()} == double_double{std::numeric_limits<double>::quiet_NaN()}));
+}
+
+BOOST_AUTO_TEST_CASE(double_double_stream_test)
+{
+	BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(double_double{}),boost::lexical_cast<std::string>(real{}));
+	BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(double_double{1.5}),boost::lexical_cast<std::string>(real{1.5}));
+	BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(double_double{std::numeric_limits<double>::infinity()}),"inf");
+	BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(double_double{std::numeric_limits<double>::quiet_NaN()}),"nan");
+	// Round trip.
+	const double_double third{rational(1,3)};
+	std::stringstream ss;
+	ss << third;
+	double_double tmp;
+	ss >> tmp;
+	BOOST_CHECK_EQUAL(tmp,third);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_pow_test)
+{
+	BOOST_CHECK_EQUAL(double_double{2}.pow(10),1024);
+	BOOST_CHECK_EQUAL(double_double{2}.pow(-2),0.25);
+	BOOST_CHECK_EQUAL(double_double{2}.pow(integer(100)),double_double{math::pow(integer(2),100)});
+	BOOST_CHECK_EQUAL(double_double{0}.pow(0),1);
+	BOOST_CHECK_EQUAL(double_double{-3}.pow(std::numeric_limits<int>::min()),double_double{-3}.pow(integer(std::numeric_limits<int>::min())));
+	const double_double third{rational(1,3)};
+	BOOST_CHECK(dd_close(third.pow(7),real{rational(1,2187),300}));
+	BOOST_CHECK((is_exponentiable<double_double,int>::value));
+	BOOST_CHECK((is_exponentiable<double_double,integer>::value));
+	BOOST_CHECK((is_exponentiable<double_double,double>::value));
+	BOOST_CHECK((is_exponentiable<double_double,double_double>::value));
+	BOOST_CHECK((is_exponentiable<double_double,real>::value));
+	BOOST_CHECK((is_exponentiable<int,double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(math::pow(double_double{},2)),double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(math::pow(double_double{},.5)),double_double>::value));
+	BOOST_CHECK((std::is_same<decltype(math::pow(double_double{},real{})),real>::value));
+	BOOST_CHECK_EQUAL(math::pow(double_double{4},.5),2);
+	BOOST_CHECK_EQUAL(math::pow(double_double{4},rational(1,2)),2);
+	BOOST_CHECK_EQUAL(math::pow(4,double_double{.5}),2);
+	BOOST_CHECK_EQUAL(math::pow(double_double{4},real{.5}),2);
+	BOOST_CHECK_EQUAL(math::pow(double_double{3},3),27);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_sin_cos_test)
+{
+	BOOST_CHECK_EQUAL(math::sin(double_double{}),0);
+	BOOST_CHECK_EQUAL(math::cos(double_double{}),1);
+	BOOST_CHECK(math::sin(double_double{std::numeric_limits<double>::infinity()}).is_nan());
+	BOOST_CHECK(math::cos(double_double{std::numeric_limits<double>::quiet_NaN()}).is_nan());
+	std::uniform_real_distribution<double> dist(-100.,100.);
+	for (int i = 0; i < ntries; ++i) {
+		const double_double x = double_double{dist(rng)} / 7;
+		const real rx{static_cast<rational>(x),300};
+		BOOST_CHECK(dd_close(math::sin(x),rx.sin(),64.) || std::abs(x.hi()) < 1E-10);
+		BOOST_CHECK(dd_close(math::cos(x),rx.cos(),64.));
+	}
+	// Large arguments go through MPFR.
+	const double_double big{1E20};
+	BOOST_CHECK(dd_close(big.sin(),real{1E20,300}.sin(),64.));
+	BOOST_CHECK(has_sine<double_double>::value);
+	BOOST_CHECK(has_cosine<double_double>::value);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_math_test)
+{
+	double_double x{-2};
+	math::negate(x);
+	BOOST_CHECK_EQUAL(x,2);
+	BOOST_CHECK(math::is_zero(double_double{}));
+	BOOST_CHECK(!math::is_zero(x));
+	BOOST_CHECK_EQUAL(math::abs(double_double{-3}),3);
+	BOOST_CHECK_EQUAL(math::partial(x,"x"),0);
+	BOOST_CHECK_EQUAL(math::evaluate(x,std::unordered_map<std::string,double>{{"x",3.}}),2);
+	BOOST_CHECK_EQUAL(math::subs(x,"x",3.),2);
+	BOOST_CHECK_EQUAL(math::ipow_subs(x,"x",integer(2),3.),2);
+	BOOST_CHECK_EQUAL(math::integral_cast(double_double{math::pow(integer(2),80)}),math::pow(integer(2),80));
+	BOOST_CHECK_THROW(math::integral_cast(double_double{1.5}),std::invalid_argument);
+	double_double y{1.};
+	y += std::ldexp(1.,-80);
+	BOOST_CHECK_THROW(math::integral_cast(y),std::invalid_argument);
+	BOOST_CHECK_THROW(math::integral_cast(double_double{std::numeric_limits<double>::infinity()}),std::invalid_argument);
+	double_double z{1};
+	math::multiply_accumulate(z,double_double{2},double_double{3});
+	BOOST_CHECK_EQUAL(z,7);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_type_traits_test)
+{
+	BOOST_CHECK(is_cf<double_double>::value);
+	BOOST_CHECK(std::is_trivially_copyable<double_double>::value);
+	BOOST_CHECK(std::is_nothrow_move_constructible<double_double>::value);
+	BOOST_CHECK(is_nothrow_destructible<double_double>::value);
+	BOOST_CHECK(is_differentiable<double_double>::value);
+	BOOST_CHECK((is_evaluable<double_double,double>::value));
+	BOOST_CHECK(has_negate<double_double>::value);
+	BOOST_CHECK(is_ostreamable<double_double>::value);
+	BOOST_CHECK(is_equality_comparable<double_double>::value);
+	BOOST_CHECK((is_addable<double_double,integer>::value));
+	BOOST_CHECK((is_addable<real,double_double>::value));
+	BOOST_CHECK((!is_addable<double_double,std::string>::value));
+	BOOST_CHECK(has_multiply_accumulate<double_double>::value);
+}
+
+BOOST_AUTO_TEST_CASE(double_double_series_test)
+{
+	// Polynomial coefficients.
+	using p_type = polynomial<double_double,kronecker_monomial<>>;
+	p_type x{"x"}, y{"y"};
+	auto p = math::pow(x + y + double_double{rational(1,3)},4);
+	BOOST_CHECK_EQUAL(p.size(),15u);
+	auto q = p * p;
+	BOOST_CHECK_EQUAL(q.size(),45u);
+	const auto ev = math::evaluate(q,std::unordered_map<std::string,double_double>{{"x",double_double{1}},{"y",double_double{2}}});
+	BOOST_CHECK((std::is_same<decltype(ev),const double_double>::value));
+	BOOST_CHECK(dd_close(ev,real{rational(10,3),300}.pow(real{8,300}),16.));
+	BOOST_CHECK_EQUAL(math::partial(x * x,"x"),2 * x);
+	// Poisson series coefficients.
+	using ps_type = poisson_series<polynomial<double_double,kronecker_monomial<>>>;
+	ps_type a{"a"}, b{"b"};
+	auto s = math::cos(a + b) * math::sin(a - b) * double_double{rational(1,3)};
+	BOOST_CHECK_EQUAL(s.size(),2u);
+	const auto ev2 = math::evaluate(s,std::unordered_map<std::string,double_double>{{"a",double_double{rational(1,7)}},{"b",double_double{rational(1,5)}}});
+	BOOST_CHECK((std::is_same<decltype(ev2),const double_double>::value));
+	const real ra{rational(1,7),300}, rb{rational(1,5),300};
+	BOOST_CHECK(dd_close(ev2,(ra + rb).cos() * (ra - rb).sin() / 3,64.));
+	BOOST_CHECK_EQUAL(math::partial(a * math::cos(a),"a"),math::cos(a) - a * math::sin(a));
+	using ps_type2 = poisson_series<double_double>;
+	BOOST_CHECK(is_cf<ps_type2>::value);
+	ps_type2 c{double_double{rational(1,3)}};
+	BOOST_CHECK(dd_close(math::cos(c).begin()->first,real{rational(1,3),300}.cos(),64.));
+	BOOST_CHECK((std::is_same<decltype(c + real{}),ps_type2>::value));
+	BOOST_CHECK_EQUAL((c * 3).begin()->first,1);
+}
@@ -0,0 +1,422 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "../src/fixed_monomial.hpp"
+
+#define BOOST_TEST_MODULE fixed_monomial_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/integer_traits.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "../src/environment.hpp"
+#include "../src/math.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/mp_rational.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/settings.hpp"
+#include "../src/symbol.hpp"
+#include "../src/symbol_set.hpp"
+#include "../src/type_traits.hpp"
+
+using namespace piranha;
+
+typedef boost::mpl::vector<signed char,short,int,long long> int_types;
+
+struct constructor_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,3u> m_type;
+		BOOST_CHECK_EQUAL(m_type::max_size,3u);
+		m_type m1;
+		BOOST_CHECK(m1[0u] == 0 && m1[1u] == 0 && m1[2u] == 0);
+		m_type m2({1,-2});
+		BOOST_CHECK(m2[0u] == 1 && m2[1u] == -2 && m2[2u] == 0);
+		BOOST_CHECK_THROW(m_type({1,2,3,4}),std::invalid_argument);
+		std::vector<int> v{3,4,5};
+		m_type m3(v.begin(),v.end());
+		BOOST_CHECK(m3[0u] == 3 && m3[1u] == 4 && m3[2u] == 5);
+		v.push_back(6);
+		BOOST_CHECK_THROW(m_type(v.begin(),v.end()),std::invalid_argument);
+		BOOST_CHECK((std::is_constructible<m_type,int *,int *>::value));
+		BOOST_CHECK((!std::is_constructible<m_type,int *,int>::value));
+		m_type m4(symbol_set({symbol("a"),symbol("b"),symbol("c")}));
+		BOOST_CHECK(m4 == m1);
+		BOOST_CHECK_THROW(m_type(symbol_set({symbol("a"),symbol("b"),symbol("c"),symbol("d")})),std::invalid_argument);
+		m_type m5(m2,symbol_set({symbol("a"),symbol("b")}));
+		BOOST_CHECK(m5 == m2);
+		BOOST_CHECK_THROW(m_type(m2,symbol_set({symbol("a")})),std::invalid_argument);
+		m5 = m3;
+		BOOST_CHECK(m5 == m3);
+		m5 = std::move(m1);
+		BOOST_CHECK(m5 == m_type{});
+		if (std::is_same<T,signed char>::value) {
+			BOOST_CHECK_THROW(m_type({1000}),boost::numeric::bad_numeric_cast);
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_constructor_test)
+{
+	environment env;
+	boost::mpl::for_each<int_types>(constructor_tester());
+}
+
+struct compatibility_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,3u> m_type;
+		m_type m1;
+		BOOST_CHECK(m1.is_compatible(symbol_set{}));
+		BOOST_CHECK(m1.is_compatible(symbol_set({symbol("a"),symbol("b"),symbol("c")})));
+		BOOST_CHECK(!m1.is_compatible(symbol_set({symbol("a"),symbol("b"),symbol("c"),symbol("d")})));
+		m_type m2({0,1});
+		BOOST_CHECK(!m2.is_compatible(symbol_set{}));
+		BOOST_CHECK(!m2.is_compatible(symbol_set({symbol("a")})));
+		BOOST_CHECK(m2.is_compatible(symbol_set({symbol("a"),symbol("b")})));
+		BOOST_CHECK(!m2.is_ignorable(symbol_set({symbol("a"),symbol("b")})));
+		BOOST_CHECK(m1.is_unitary(symbol_set{}));
+		BOOST_CHECK(!m2.is_unitary(symbol_set({symbol("a"),symbol("b")})));
+		BOOST_CHECK_THROW(m2.is_unitary(symbol_set({symbol("a")})),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_compatibility_test)
+{
+	boost::mpl::for_each<int_types>(compatibility_tester());
+}
+
+struct merge_args_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		symbol_set v1, v2;
+		v2.add("a");
+		m_type m1;
+		BOOST_CHECK(m1.merge_args(v1,v2) == m_type{});
+		v1.add("b");
+		v2.add("b");
+		v2.add("d");
+		m_type m2({2});
+		BOOST_CHECK((m2.merge_args(v1,v2) == m_type{0,2,0}));
+		v1.add("c");
+		v2.add("c");
+		m_type m3({2,3});
+		BOOST_CHECK((m3.merge_args(v1,v2) == m_type{0,2,3,0}));
+		// Too many symbols.
+		v2.add("e");
+		BOOST_CHECK_THROW(m3.merge_args(v1,v2),std::invalid_argument);
+		// Invalid merges.
+		BOOST_CHECK_THROW(m3.merge_args(v1,v1),std::invalid_argument);
+		BOOST_CHECK_THROW(m3.merge_args(v1,symbol_set({symbol("a"),symbol("b")})),std::invalid_argument);
+		BOOST_CHECK_THROW(m3.merge_args(symbol_set({symbol("b")}),v1),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_merge_args_test)
+{
+	boost::mpl::for_each<int_types>(merge_args_tester());
+}
+
+struct degree_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("a"),symbol("b"),symbol("c")});
+		m_type m1({1,-2,5});
+		BOOST_CHECK_EQUAL(m1.degree(args),4);
+		BOOST_CHECK_EQUAL(m1.ldegree(args),4);
+		BOOST_CHECK_THROW(m1.degree(symbol_set({symbol("a")})),std::invalid_argument);
+		BOOST_CHECK_EQUAL(m1.degree({"a","c"},args),6);
+		BOOST_CHECK_EQUAL(m1.ldegree({"b","d"},args),-2);
+		BOOST_CHECK_EQUAL(m1.degree(std::set<std::string>{},args),0);
+		BOOST_CHECK_EQUAL(m1.degree(symbol_set::positions(args,{"a","b"}),args),-1);
+		BOOST_CHECK_EQUAL(m1.ldegree(symbol_set::positions(args,{"c"}),args),5);
+		BOOST_CHECK_THROW(m1.degree(symbol_set::positions(args,{"c"}),symbol_set({symbol("a"),symbol("b")})),std::invalid_argument);
+		BOOST_CHECK_THROW(m_type().degree(symbol_set::positions(args,{"c"}),symbol_set({symbol("a"),symbol("b")})),std::invalid_argument);
+		BOOST_CHECK(key_has_degree<m_type>::value);
+		BOOST_CHECK(key_has_ldegree<m_type>::value);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_degree_test)
+{
+	boost::mpl::for_each<int_types>(degree_tester());
+}
+
+struct multiply_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("a"),symbol("b"),symbol("c")});
+		m_type m1({1,-2,5}), m2({3,2,-1}), out;
+		m1.multiply(out,m2,args);
+		BOOST_CHECK((out == m_type{4,0,4}));
+		// In place.
+		m1.multiply(m1,m1,args);
+		BOOST_CHECK((m1 == m_type{2,-4,10}));
+		BOOST_CHECK_THROW(m1.multiply(out,m2,symbol_set({symbol("a"),symbol("b"),symbol("c"),symbol("d"),symbol("e")})),
+			std::invalid_argument);
+		// Overflow.
+		m_type m3({boost::integer_traits<T>::const_max,T(0),T(0)}), m4({1});
+		BOOST_CHECK_THROW(m3.multiply(out,m4,args),std::overflow_error);
+		m_type m5({boost::integer_traits<T>::const_min,T(0),T(0)}), m6({-1});
+		BOOST_CHECK_THROW(m5.multiply(out,m6,args),std::overflow_error);
+		m5.multiply(out,m4,args);
+		BOOST_CHECK_EQUAL(out[0u],boost::integer_traits<T>::const_min + 1);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_multiply_test)
+{
+	boost::mpl::for_each<int_types>(multiply_tester());
+}
+
+struct equality_hash_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,5u> m_type;
+		BOOST_CHECK(m_type{} == m_type{});
+		BOOST_CHECK((m_type{1,2} == m_type{1,2,0}));
+		BOOST_CHECK((m_type{1,2} != m_type{1,2,1}));
+		BOOST_CHECK((m_type{1,2} != m_type{2,1}));
+		BOOST_CHECK((m_type{1,2}.hash() == m_type{1,2,0}.hash()));
+		BOOST_CHECK((std::hash<m_type>()(m_type{1,2}) == m_type{1,2}.hash()));
+		BOOST_CHECK(is_hashable<m_type>::value);
+		BOOST_CHECK(is_key<m_type>::value);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_equality_hash_test)
+{
+	boost::mpl::for_each<int_types>(equality_hash_tester());
+}
+
+struct print_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("x"),symbol("y"),symbol("z")});
+		std::ostringstream oss;
+		m_type({1,0,-2}).print(oss,args);
+		BOOST_CHECK_EQUAL(oss.str(),"x*z**-2");
+		oss.str("");
+		m_type{}.print(oss,args);
+		BOOST_CHECK_EQUAL(oss.str(),"");
+		oss.str("");
+		m_type({1,0,-2}).print_tex(oss,args);
+		BOOST_CHECK_EQUAL(oss.str(),"\\frac{{x}}{{z}^{2}}");
+		oss.str("");
+		m_type({0,-1,-2}).print_tex(oss,args);
+		BOOST_CHECK_EQUAL(oss.str(),"\\frac{1}{{y}{z}^{2}}");
+		oss.str("");
+		m_type({boost::integer_traits<T>::const_min}).print_tex(oss,symbol_set({symbol("x")}));
+		BOOST_CHECK_EQUAL(oss.str(),std::string("\\frac{1}{{x}^{") + boost::lexical_cast<std::string>(-integer(boost::integer_traits<T>::const_min)) + "}}");
+		BOOST_CHECK_THROW(m_type({1,0,-2}).print(oss,symbol_set({symbol("x")})),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_print_test)
+{
+	boost::mpl::for_each<int_types>(print_tester());
+}
+
+struct linear_argument_pow_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("x"),symbol("y"),symbol("z")});
+		BOOST_CHECK_EQUAL(m_type({0,1,0}).linear_argument(args),"y");
+		BOOST_CHECK_THROW(m_type{}.linear_argument(args),std::invalid_argument);
+		BOOST_CHECK_THROW(m_type({0,2,0}).linear_argument(args),std::invalid_argument);
+		BOOST_CHECK_THROW(m_type({1,1,0}).linear_argument(args),std::invalid_argument);
+		BOOST_CHECK((m_type({1,-2,3}).pow(2,args) == m_type{2,-4,6}));
+		BOOST_CHECK((m_type({1,-2,3}).pow(integer(-1),args) == m_type{-1,2,-3}));
+		BOOST_CHECK((m_type({1,-2,3}).pow(0,args) == m_type{}));
+		BOOST_CHECK_THROW(m_type({1,-2,3}).pow(rational(1,2),args),std::invalid_argument);
+		BOOST_CHECK_THROW(m_type({2}).pow(boost::integer_traits<T>::const_max,symbol_set({symbol("x")})),std::overflow_error);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_linear_argument_pow_test)
+{
+	boost::mpl::for_each<int_types>(linear_argument_pow_tester());
+}
+
+struct calculus_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("x"),symbol("z")});
+		// Partial derivative.
+		auto ret = m_type({2,-1}).partial(symbol("x"),args);
+		BOOST_CHECK_EQUAL(ret.first,2);
+		BOOST_CHECK((ret.second == m_type{1,-1}));
+		ret = m_type({2,-1}).partial(symbol("z"),args);
+		BOOST_CHECK_EQUAL(ret.first,-1);
+		BOOST_CHECK((ret.second == m_type{2,-2}));
+		ret = m_type({0,-1}).partial(symbol("x"),args);
+		BOOST_CHECK_EQUAL(ret.first,0);
+		BOOST_CHECK(ret.second == m_type{});
+		ret = m_type({2,-1}).partial(symbol("y"),args);
+		BOOST_CHECK_EQUAL(ret.first,0);
+		BOOST_CHECK_THROW(m_type({boost::integer_traits<T>::const_min}).partial(symbol("x"),symbol_set({symbol("x")})),std::overflow_error);
+		// Integration.
+		ret = m_type({2,-2}).integrate(symbol("x"),args);
+		BOOST_CHECK_EQUAL(ret.first,3);
+		BOOST_CHECK((ret.second == m_type{3,-2}));
+		ret = m_type({2,-2}).integrate(symbol("y"),args);
+		BOOST_CHECK_EQUAL(ret.first,1);
+		BOOST_CHECK((ret.second == m_type{2,1,-2}));
+		ret = m_type({2,-2}).integrate(symbol("a"),args);
+		BOOST_CHECK((ret.second == m_type{1,2,-2}));
+		ret = m_type({2,-2}).integrate(symbol("zz"),args);
+		BOOST_CHECK((ret.second == m_type{2,-2,1}));
+		BOOST_CHECK_THROW(m_type({2,-1}).integrate(symbol("z"),args),std::invalid_argument);
+		BOOST_CHECK_THROW(m_type({1,2,3,4}).integrate(symbol("y"),symbol_set({symbol("a"),symbol("b"),symbol("c"),symbol("d")})),
+			std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_calculus_test)
+{
+	boost::mpl::for_each<int_types>(calculus_tester());
+}
+
+struct evaluate_subs_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("x"),symbol("y"),symbol("z")});
+		typedef std::unordered_map<symbol,integer> dict_type;
+		BOOST_CHECK_EQUAL(m_type({1,2,3}).evaluate(dict_type{{symbol("x"),integer(2)},{symbol("y"),integer(3)},
+			{symbol("z"),integer(-1)}},args),-18);
+		BOOST_CHECK_THROW(m_type({1,2,3}).evaluate(dict_type{{symbol("x"),integer(2)}},args),std::invalid_argument);
+		BOOST_CHECK_EQUAL(m_type{}.evaluate(dict_type{},symbol_set{}),1);
+		// Substitution.
+		auto ret = m_type({1,2,3}).subs(symbol("y"),integer(2),args);
+		BOOST_CHECK_EQUAL(ret.first,4);
+		BOOST_CHECK((ret.second == m_type{1,3}));
+		ret = m_type({1,2,3}).subs(symbol("z"),integer(2),args);
+		BOOST_CHECK_EQUAL(ret.first,8);
+		BOOST_CHECK((ret.second == m_type{1,2}));
+		ret = m_type({1,2,3}).subs(symbol("t"),integer(2),args);
+		BOOST_CHECK_EQUAL(ret.first,1);
+		BOOST_CHECK((ret.second == m_type{1,2,3}));
+		// Integral power substitution.
+		ret = m_type({1,7,3}).ipow_subs(symbol("y"),integer(2),integer(5),args);
+		BOOST_CHECK_EQUAL(ret.first,125);
+		BOOST_CHECK((ret.second == m_type{1,1,3}));
+		ret = m_type({1,-7,3}).ipow_subs(symbol("y"),integer(-2),integer(5),args);
+		BOOST_CHECK_EQUAL(ret.first,125);
+		BOOST_CHECK((ret.second == m_type{1,-1,3}));
+		ret = m_type({1,1,3}).ipow_subs(symbol("y"),integer(2),integer(5),args);
+		BOOST_CHECK_EQUAL(ret.first,1);
+		BOOST_CHECK((ret.second == m_type{1,1,3}));
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_evaluate_subs_test)
+{
+	boost::mpl::for_each<int_types>(evaluate_subs_tester());
+}
+
+struct trim_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef fixed_monomial<T,4u> m_type;
+		const symbol_set args({symbol("x"),symbol("y"),symbol("z")});
+		symbol_set candidates(args);
+		m_type({1,0,0}).trim_identify(candidates,args);
+		BOOST_CHECK(candidates == symbol_set({symbol("y"),symbol("z")}));
+		m_type({0,0,-1}).trim_identify(candidates,args);
+		BOOST_CHECK(candidates == symbol_set({symbol("y")}));
+		BOOST_CHECK((m_type({1,0,-1}).trim(candidates,args) == m_type{1,-1}));
+		BOOST_CHECK((m_type({1,0,-1}).trim(symbol_set{},args) == m_type{1,0,-1}));
+		BOOST_CHECK((m_type({1,0,-1}).trim(args,args) == m_type{}));
+	}
+};
+
+BOOST_AUTO_TEST_CASE(fixed_monomial_trim_test)
+{
+	boost::mpl::for_each<int_types>(trim_tester());
+}
+
+// Use in polynomials, checked against polynomials with unpacked monomials.
+BOOST_AUTO_TEST_CASE(fixed_monomial_polynomial_test)
+{
+	typedef polynomial<integer,fixed_monomial<int,5u>> p_type;
+	typedef polynomial<integer,int> p_type_ref;
+	p_type x("x"), y("y"), z("z"), t("t"), u("u");
+	p_type_ref x_r("x"), y_r("y"), z_r("z"), t_r("t"), u_r("u");
+	std::unordered_map<std::string,integer> dict{{"x",integer(2)},{"y",integer(-3)},{"z",integer(5)},{"t",integer(-1)},{"u",integer(7)}};
+	const auto f = math::pow(1 + x + y + z + t,6), g = math::pow(1 - x + y - u,6);
+	const auto f_r = math::pow(1 + x_r + y_r + z_r + t_r,6), g_r = math::pow(1 - x_r + y_r - u_r,6);
+	for (unsigned n_threads = 1u; n_threads <= 4u; ++n_threads) {
+		settings::set_n_threads(n_threads);
+		const auto res = f * g;
+		const auto res_r = f_r * g_r;
+		BOOST_CHECK_EQUAL(res.size(),res_r.size());
+		BOOST_CHECK_EQUAL(math::evaluate(res,dict),math::evaluate(res_r,dict));
+	}
+	settings::reset_n_threads();
+	BOOST_CHECK_EQUAL(math::degree(f * g),12);
+	BOOST_CHECK_EQUAL(math::degree(f * g,{"x"}),12);
+	BOOST_CHECK_EQUAL(math::evaluate(math::partial(f * g,"y"),dict),math::evaluate(math::partial(f_r * g_r,"y"),dict));
+	BOOST_CHECK_EQUAL(math::evaluate(math::integrate(f,"y"),dict),math::evaluate(math::integrate(f_r,"y"),dict));
+	BOOST_CHECK_EQUAL(math::evaluate(math::subs(f,"y",integer(4)),dict),math::evaluate(math::subs(f_r,"y",integer(4)),dict));
+	std::ostringstream oss1, oss2;
+	oss1 << (x * y - 3 * z);
+	oss2 << (x_r * y_r - 3 * z_r);
+	BOOST_CHECK_EQUAL(oss1.str(),oss2.str());
+	// More than 5 symbols cannot be represented.
+	BOOST_CHECK_THROW(f * g * p_type("v"),std::invalid_argument);
+}
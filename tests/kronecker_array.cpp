@@ -28,13 +28,18 @@
 #include <boost/mpl/vector.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <typeinfo>
 #include <vector>
 
+#include "../src/debug_access.hpp"
+#include "../src/detail/kronecker_int.hpp"
 #include "../src/environment.hpp"
+#include "../src/mp_integer.hpp"
 
 using namespace piranha;
 
@@ -72,6 +77,35 @@ BOOST_AUTO_TEST_CASE(kronecker_array_limits_test)
 	boost::mpl::for_each<int_types>(limits_tester());
 }
 
+struct tables_tag {};
+
+namespace piranha
+{
+
+template <>
+class debug_access<tables_tag>
+{
+	public:
+		template <typename T>
+		void operator()(const T &)
+		{
+			typedef kronecker_array<T> ka_type;
+			// The precomputed tables must match the limits computed at runtime.
+			BOOST_CHECK(ka_type::load_limits() == ka_type::determine_limits());
+			BOOST_CHECK(ka_type::get_limits() == ka_type::determine_limits());
+		}
+};
+
+}
+
+typedef debug_access<tables_tag> tables_tester;
+
+BOOST_AUTO_TEST_CASE(kronecker_array_tables_test)
+{
+	boost::mpl::for_each<int_types>(tables_tester());
+	boost::mpl::for_each<boost::mpl::vector<signed char,short,int,long,long long>>(tables_tester());
+}
+
 // Coding/decoding.
 struct coding_tester
 {
@@ -143,3 +177,188 @@ BOOST_AUTO_TEST_CASE(kronecker_array_coding_test)
 {
 	boost::mpl::for_each<int_types>(coding_tester());
 }
+
+// Batch decoding and comparison with decoding via hardware division.
+struct decode_n_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef kronecker_array<T> ka_type;
+		const auto &l = ka_type::get_limits();
+		std::mt19937 rng;
+		for (std::size_t m = 1u; m < l.size(); ++m) {
+			const auto &minmax_vec = std::get<0u>(l[m]);
+			const auto hmin = std::get<1u>(l[m]), hmax = std::get<2u>(l[m]);
+			std::uniform_int_distribution<long long> dist(hmin,hmax);
+			std::vector<T> codes{hmin,hmax,T(0)};
+			for (int i = 0; i < 1000; ++i) {
+				codes.push_back(static_cast<T>(dist(rng)));
+			}
+			std::vector<T> out(codes.size() * m), tmp(m);
+			ka_type::decode_n(out.data(),m,codes.data(),codes.size());
+			for (std::size_t j = 0u; j < codes.size(); ++j) {
+				ka_type::decode(tmp,codes[j]);
+				// Reference decoding.
+				long long code = static_cast<long long>(codes[j]) - hmin, mod_arg = 1;
+				for (std::size_t i = 0u; i < m; ++i) {
+					const long long d = 2 * static_cast<long long>(minmax_vec[i]) + 1;
+					BOOST_CHECK_EQUAL(static_cast<long long>(tmp[i]),(code / mod_arg) % d - minmax_vec[i]);
+					BOOST_CHECK_EQUAL(out[i * codes.size() + j],tmp[i]);
+					if (i + 1u < m) {
+						mod_arg *= d;
+					}
+				}
+			}
+			// Out of bounds codes.
+			if (hmin > std::numeric_limits<T>::min()) {
+				codes.push_back(static_cast<T>(hmin - 1));
+				out.resize(codes.size() * m);
+				BOOST_CHECK_THROW(ka_type::decode_n(out.data(),m,codes.data(),codes.size()),std::invalid_argument);
+			}
+		}
+		std::vector<T> codes{T(0),T(0)}, out(2u);
+		BOOST_CHECK_NO_THROW(ka_type::decode_n(out.data(),0u,codes.data(),codes.size()));
+		codes[1u] = T(1);
+		BOOST_CHECK_THROW(ka_type::decode_n(out.data(),0u,codes.data(),codes.size()),std::invalid_argument);
+		BOOST_CHECK_THROW(ka_type::decode_n(out.data(),l.size(),codes.data(),codes.size()),std::invalid_argument);
+		BOOST_CHECK_NO_THROW(ka_type::decode_n(out.data(),1u,codes.data(),0u));
+	}
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_array_decode_n_test)
+{
+	boost::mpl::for_each<int_types>(decode_n_tester());
+}
+
+struct first_nonzero_sign_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef kronecker_array<T> ka_type;
+		const auto &l = ka_type::get_limits();
+		std::mt19937 rng;
+		for (std::size_t m = 1u; m < l.size(); ++m) {
+			const auto hmin = std::get<1u>(l[m]), hmax = std::get<2u>(l[m]);
+			std::uniform_int_distribution<long long> dist(hmin,hmax);
+			std::vector<T> codes{hmin,hmax,T(0)};
+			for (int i = 0; i < 1000; ++i) {
+				codes.push_back(static_cast<T>(dist(rng)));
+			}
+			// Vectors with leading zeroes.
+			std::vector<T> tmp(m);
+			for (std::size_t i = 0u; i < m; ++i) {
+				tmp[i] = T(1);
+				codes.push_back(ka_type::encode(tmp));
+				tmp[i] = T(-1);
+				codes.push_back(ka_type::encode(tmp));
+				tmp[i] = T(0);
+			}
+			for (const auto &n: codes) {
+				ka_type::decode(tmp,n);
+				int ref = 0;
+				for (const auto &c: tmp) {
+					if (c != T(0)) {
+						ref = (c > T(0)) ? 1 : -1;
+						break;
+					}
+				}
+				BOOST_CHECK_EQUAL(ka_type::first_nonzero_sign(n,m),ref);
+				// The codification is symmetric.
+				BOOST_CHECK_EQUAL(ka_type::first_nonzero_sign(static_cast<T>(-n),m),-ref);
+			}
+			if (hmin > std::numeric_limits<T>::min()) {
+				BOOST_CHECK_THROW(ka_type::first_nonzero_sign(static_cast<T>(hmin - 1),m),std::invalid_argument);
+			}
+		}
+		BOOST_CHECK_EQUAL(ka_type::first_nonzero_sign(T(0),0u),0);
+		BOOST_CHECK_THROW(ka_type::first_nonzero_sign(T(1),0u),std::invalid_argument);
+		BOOST_CHECK_THROW(ka_type::first_nonzero_sign(T(0),l.size()),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_array_first_nonzero_sign_test)
+{
+	boost::mpl::for_each<int_types>(first_nonzero_sign_tester());
+}
+
+#if defined(PIRANHA_INT128_T)
+
+// 128-bit codes. The reference values are computed with piranha::integer.
+BOOST_AUTO_TEST_CASE(kronecker_array_int128_test)
+{
+	typedef PIRANHA_INT128_T int_type;
+	typedef kronecker_array<int_type> ka_type;
+	const auto &l = ka_type::get_limits();
+	// The 128-bit limits must allow for more variables than the 64-bit ones, and larger exponents.
+	const auto &l64 = kronecker_array<long long>::get_limits();
+	BOOST_CHECK(l.size() > l64.size());
+	for (std::size_t m = 1u; m < l64.size(); ++m) {
+		BOOST_CHECK(std::get<0u>(l[m])[0u] > std::get<0u>(l64[m])[0u]);
+	}
+	BOOST_CHECK(std::get<0u>(l[12u])[11u] > 100);
+	// Conversions to and from integer.
+	const int_type max = detail::ka_int_traits<int_type>::max(), min = detail::ka_int_traits<int_type>::min();
+	BOOST_CHECK(detail::ka_to_integer(max) == integer(2).pow(127u) - 1);
+	BOOST_CHECK(detail::ka_to_integer(min) == -integer(2).pow(127u));
+	BOOST_CHECK(detail::ka_from_integer<int_type>(detail::ka_to_integer(max)) == max);
+	BOOST_CHECK(detail::ka_from_integer<int_type>(detail::ka_to_integer(min)) == min);
+	BOOST_CHECK(detail::ka_from_integer<int_type>(integer(-42)) == -42);
+	BOOST_CHECK_THROW(detail::ka_from_integer<int_type>(integer(2).pow(127u)),std::overflow_error);
+	BOOST_CHECK_THROW(detail::ka_from_integer<int_type>(-integer(2).pow(127u) - 1),std::overflow_error);
+	std::mt19937 rng;
+	std::uniform_int_distribution<long long> sdist;
+	for (std::size_t m = 1u; m < l.size(); ++m) {
+		const auto &minmax_vec = std::get<0u>(l[m]);
+		const integer hmin = detail::ka_to_integer(std::get<1u>(l[m])), hmax = detail::ka_to_integer(std::get<2u>(l[m]));
+		BOOST_CHECK(hmax - hmin == detail::ka_to_integer(std::get<3u>(l[m])));
+		// Coding weights.
+		std::vector<integer> c_vec{integer(1)};
+		for (std::size_t i = 1u; i < m; ++i) {
+			c_vec.push_back(c_vec.back() * (2 * detail::ka_to_integer(minmax_vec[i - 1u]) + 1));
+		}
+		BOOST_CHECK(hmax - hmin < integer(2).pow(127u) - 1);
+		std::vector<int_type> v(m), tmp(m), codes;
+		for (int n = 0; n < 20; ++n) {
+			integer ref(0);
+			for (std::size_t i = 0u; i < m; ++i) {
+				const integer M = detail::ka_to_integer(minmax_vec[i]);
+				// Random exponent in [-M,M], using 2 random 64-bit values.
+				const integer r = (integer(sdist(rng)) * integer(2).pow(64u) + sdist(rng)).abs() % (2 * M + 1) - M;
+				v[i] = detail::ka_from_integer<int_type>(r);
+				ref += r * c_vec[i];
+			}
+			const auto code = ka_type::encode(v);
+			BOOST_CHECK(detail::ka_to_integer(code) == ref);
+			ka_type::decode(tmp,code);
+			BOOST_CHECK(tmp == v);
+			codes.push_back(code);
+		}
+		codes.push_back(std::get<1u>(l[m]));
+		codes.push_back(std::get<2u>(l[m]));
+		std::vector<int_type> out(codes.size() * m);
+		ka_type::decode_n(out.data(),m,codes.data(),codes.size());
+		for (std::size_t j = 0u; j < codes.size(); ++j) {
+			ka_type::decode(tmp,codes[j]);
+			for (std::size_t i = 0u; i < m; ++i) {
+				BOOST_CHECK(out[i * codes.size() + j] == tmp[i]);
+			}
+		}
+		// Decoding into a narrower type.
+		std::vector<long long> v_ll(m);
+		ka_type::decode(v_ll,int_type(0));
+		BOOST_CHECK(v_ll == std::vector<long long>(m));
+		std::vector<int_type> v_max(m);
+		v_max[0u] = minmax_vec[0u];
+		if (minmax_vec[0u] > std::numeric_limits<long long>::max()) {
+			BOOST_CHECK_THROW(ka_type::decode(v_ll,ka_type::encode(v_max)),std::bad_cast);
+		}
+	}
+	BOOST_CHECK_THROW(ka_type::encode(std::vector<int_type>(l.size())),std::invalid_argument);
+	BOOST_CHECK_THROW(ka_type::encode(std::vector<int_type>{int_type(0),max}),std::invalid_argument);
+	// Encoding from a narrower type.
+	BOOST_CHECK(ka_type::encode(std::vector<int>{1,-2}) == ka_type::encode(std::vector<int_type>{1,-2}));
+}
+
+#endif
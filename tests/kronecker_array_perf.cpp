@@ -0,0 +1,108 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+#include "../src/kronecker_array.hpp"
+
+#define BOOST_TEST_MODULE kronecker_array_test
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/timer/timer.hpp>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+#include "../src/environment.hpp"
+#include "../src/static_vector.hpp"
+
+using namespace piranha;
+
+// Number of codes to decode.
+static const std::size_t n_codes = 10000000ull;
+
+// Decoding of Kronecker codes: decoding via hardware division (the original implementation) vs single
+// and batch decoding in kronecker_array.
+struct decode_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef kronecker_array<T> ka_type;
+		const auto &l = ka_type::get_limits();
+		std::mt19937 rng;
+		for (std::size_t m: {std::size_t(3u),std::size_t(6u),l.size() - 1u}) {
+			std::cout << "Type: " << typeid(T).name() << ", dimension: " << m << '\n';
+			const auto &minmax_vec = std::get<0u>(l[m]);
+			const auto hmin = std::get<1u>(l[m]), hmax = std::get<2u>(l[m]);
+			std::uniform_int_distribution<long long> dist(hmin,hmax);
+			std::vector<T> codes;
+			for (std::size_t i = 0u; i < n_codes; ++i) {
+				codes.push_back(static_cast<T>(dist(rng)));
+			}
+			static_vector<T,255u> tmp(static_cast<typename static_vector<T,255u>::size_type>(m),0);
+			long long acc = 0;
+			{
+				std::cout << "Division: ";
+				boost::timer::auto_cpu_timer t;
+				for (const auto &n: codes) {
+					const T code = static_cast<T>(n - hmin);
+					T mod_arg = static_cast<T>(2 * minmax_vec[0u] + 1);
+					tmp[0u] = static_cast<T>((code % mod_arg) - minmax_vec[0u]);
+					for (std::size_t i = 1u; i < m; ++i) {
+						tmp[i] = static_cast<T>((code % (mod_arg * (2 * minmax_vec[i] + 1))) / mod_arg - minmax_vec[i]);
+						mod_arg = static_cast<T>(mod_arg * (2 * minmax_vec[i] + 1));
+					}
+					acc += tmp[m - 1u];
+				}
+			}
+			{
+				std::cout << "decode(): ";
+				boost::timer::auto_cpu_timer t;
+				for (const auto &n: codes) {
+					ka_type::decode(tmp,n);
+					acc -= tmp[m - 1u];
+				}
+			}
+			// Batch decoding in blocks, reusing the output buffer.
+			const std::size_t block_size = 10000u;
+			std::vector<T> out(block_size * m);
+			{
+				std::cout << "decode_n(): ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < codes.size(); i += block_size) {
+					const auto size = std::min(block_size,codes.size() - i);
+					ka_type::decode_n(out.data(),m,codes.data() + i,size);
+					acc += out[(m - 1u) * size];
+				}
+			}
+			std::cout << "Checksum: " << acc << "\n\n";
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_array_decode_test)
+{
+	environment env;
+	boost::mpl::for_each<boost::mpl::vector<int,long long>>(decode_tester());
+}
@@ -0,0 +1,77 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+#include "../src/kronecker_array.hpp"
+
+#define BOOST_TEST_MODULE kronecker_array_startup_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/timer/timer.hpp>
+#include <iostream>
+#include <typeinfo>
+
+#include "../src/debug_access.hpp"
+#include "../src/environment.hpp"
+
+using namespace piranha;
+
+// Compare the cost of loading the precomputed Kronecker limits, which is paid by every process at startup,
+// with the cost of computing them at runtime.
+struct startup_tag {};
+
+namespace piranha
+{
+
+template <>
+class debug_access<startup_tag>
+{
+	public:
+		template <typename T>
+		void operator()(const T &)
+		{
+			typedef kronecker_array<T> ka_type;
+			std::cout << "Type: " << typeid(T).name() << '\n';
+			{
+				std::cout << "Precomputed tables: ";
+				boost::timer::auto_cpu_timer t;
+				for (int i = 0; i < 1000; ++i) {
+					ka_type::load_limits();
+				}
+			}
+			{
+				std::cout << "Runtime computation: ";
+				boost::timer::auto_cpu_timer t;
+				for (int i = 0; i < 1000; ++i) {
+					ka_type::determine_limits();
+				}
+			}
+		}
+};
+
+}
+
+typedef debug_access<startup_tag> startup_tester;
+
+BOOST_AUTO_TEST_CASE(kronecker_array_startup_test)
+{
+	environment env;
+	boost::mpl::for_each<boost::mpl::vector<signed char,short,int,long long>>(startup_tester());
+}
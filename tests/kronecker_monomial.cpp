@@ -29,6 +29,7 @@
 #include <boost/mpl/vector.hpp>
 #include <cstddef>
 #include <initializer_list>
+#include <random>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -185,6 +186,10 @@ struct merge_args_tester
 		vs1 = symbol_set({symbol("c")});
 		k_type k4({-1});
 		BOOST_CHECK(k4.merge_args(vs1,vs2).get_int() == ka::encode(std::vector<int>({0,0,-1,0})));
+		// Merging another key with the same symbol sets.
+		k_type k6({1});
+		BOOST_CHECK(k6.merge_args(vs1,vs2).get_int() == ka::encode(std::vector<int>({0,0,1,0})));
+		BOOST_CHECK(k4.merge_args(vs1,vs2).get_int() == ka::encode(std::vector<int>({0,0,-1,0})));
 		vs1 = symbol_set({});
 		k_type k5({});
 		BOOST_CHECK(k5.merge_args(vs1,vs2).get_int() == ka::encode(std::vector<int>({0,0,0,0})));
@@ -278,6 +283,12 @@ struct degree_tester
 		BOOST_CHECK(k5.ldegree({"d","c"},vs1) == 0);
 		BOOST_CHECK(k5.ldegree({"d","b"},vs1) == -1);
 		BOOST_CHECK(k5.ldegree({"A","a"},vs1) == -1);
+		// Partial degree from positions.
+		BOOST_CHECK(k5.degree(symbol_set::positions(vs1,{"a"}),vs1) == -1);
+		BOOST_CHECK(k5.degree(symbol_set::positions(vs1,{"a","b"}),vs1) == -2);
+		BOOST_CHECK(k5.degree(symbol_set::positions(vs1,{"c"}),vs1) == 0);
+		BOOST_CHECK(k5.ldegree(symbol_set::positions(vs1,{"A","b"}),vs1) == -1);
+		BOOST_CHECK_THROW(k5.degree(symbol_set::positions(vs1,{"b"}),symbol_set({symbol("a")})),std::invalid_argument);
 	}
 };
 
@@ -314,6 +325,21 @@ struct multiply_tester
 		ka::decode(tmp,result.get_int());
 		BOOST_CHECK(tmp[0u] == 3);
 		BOOST_CHECK(tmp[1u] == -1);
+		// Pre-validated bounds.
+		result = k_type{};
+		k1.multiply(result,k2,vs1,true);
+		ka::decode(tmp,result.get_int());
+		BOOST_CHECK(tmp[0u] == 3);
+		BOOST_CHECK(tmp[1u] == -1);
+		// Out of bounds.
+		const auto &limits = ka::get_limits();
+		const auto &M = std::get<0u>(limits[2u]);
+		k1 = k_type{M[0u],T(0)};
+		k2 = k_type{T(1),T(0)};
+		BOOST_CHECK_THROW(k1.multiply(result,k2,vs1),std::invalid_argument);
+		k1 = k_type{T(0),T(-M[1u])};
+		k2 = k_type{T(0),T(-1)};
+		BOOST_CHECK_THROW(k1.multiply(result,k2,vs1),std::invalid_argument);
 	}
 };
 
@@ -322,6 +348,132 @@ BOOST_AUTO_TEST_CASE(kronecker_monomial_multiply_test)
 	boost::mpl::for_each<int_types>(multiply_tester());
 }
 
+struct divide_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef kronecker_monomial<T> k_type;
+		typedef kronecker_array<T> ka;
+		k_type k1, k2, result;
+		symbol_set vs1;
+		k1.divide(result,k2,vs1);
+		BOOST_CHECK(result.get_int() == 0);
+		vs1.add(symbol("a"));
+		k1 = k_type({1});
+		k2 = k_type({3});
+		k1.divide(result,k2,vs1);
+		BOOST_CHECK(result.get_int() == -2);
+		k1 = k_type({1,-1});
+		k2 = k_type({2,-3});
+		vs1.add(symbol("b"));
+		k1.divide(result,k2,vs1);
+		std::vector<int> tmp(2u);
+		ka::decode(tmp,result.get_int());
+		BOOST_CHECK(tmp[0u] == -1);
+		BOOST_CHECK(tmp[1u] == 2);
+		result = k_type{};
+		k1.divide(result,k2,vs1,true);
+		ka::decode(tmp,result.get_int());
+		BOOST_CHECK(tmp[0u] == -1);
+		BOOST_CHECK(tmp[1u] == 2);
+		// Multiplication and division are inverse of each other.
+		k_type result2;
+		result.multiply(result2,k2,vs1);
+		BOOST_CHECK(result2 == k1);
+		const auto &M = std::get<0u>(ka::get_limits()[2u]);
+		k1 = k_type{T(-M[0u]),T(0)};
+		k2 = k_type{T(1),T(0)};
+		BOOST_CHECK_THROW(k1.divide(result,k2,vs1),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_monomial_divide_test)
+{
+	boost::mpl::for_each<int_types>(divide_tester());
+}
+
+// Check the packed-domain operations against their definitions on the unpacked exponents.
+struct packed_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef kronecker_monomial<T> k_type;
+		typedef kronecker_array<T> ka;
+		typedef typename k_type::v_type v_type;
+		const auto &limits = ka::get_limits();
+		std::mt19937 rng;
+		symbol_set vs;
+		for (auto i = 1u; i < 6u && i < limits.size(); ++i) {
+			vs.add(symbol(std::string(1u,static_cast<char>('a' + i))));
+			const auto &M = std::get<0u>(limits[i]);
+			for (int n = 0; n < 200; ++n) {
+				v_type v1, v2;
+				for (auto j = 0u; j < i; ++j) {
+					std::uniform_int_distribution<long long> dist(-static_cast<long long>(M[j]),static_cast<long long>(M[j]));
+					v1.push_back(static_cast<T>(dist(rng)));
+					v2.push_back(static_cast<T>(dist(rng)));
+				}
+				const k_type k1(v1.begin(),v1.end()), k2(v2.begin(),v2.end());
+				// Multiplication/division.
+				bool in_bounds = true;
+				for (auto j = 0u; j < i; ++j) {
+					const long long s = static_cast<long long>(v1[j]) + v2[j];
+					in_bounds = in_bounds && s >= -static_cast<long long>(M[j]) && s <= static_cast<long long>(M[j]);
+				}
+				k_type res;
+				if (in_bounds) {
+					k1.multiply(res,k2,vs);
+					const auto u = res.unpack(vs);
+					for (auto j = 0u; j < i; ++j) {
+						BOOST_CHECK_EQUAL(u[j],v1[j] + v2[j]);
+					}
+					res.divide(res,k2,vs);
+					BOOST_CHECK(res == k1);
+				} else {
+					BOOST_CHECK_THROW(k1.multiply(res,k2,vs),std::invalid_argument);
+				}
+				// Degree.
+				long long deg = 0;
+				for (auto j = 0u; j < i; ++j) {
+					deg += v1[j];
+				}
+				BOOST_CHECK_EQUAL(static_cast<long long>(k1.degree(vs)),deg);
+				// Power.
+				for (int e = -3; e < 4; ++e) {
+					bool pow_ok = true;
+					for (auto j = 0u; j < i; ++j) {
+						const long long p = static_cast<long long>(v1[j]) * e;
+						pow_ok = pow_ok && p >= -static_cast<long long>(M[j]) && p <= static_cast<long long>(M[j]);
+					}
+					if (pow_ok) {
+						const auto u = k1.pow(e,vs).unpack(vs);
+						for (auto j = 0u; j < i; ++j) {
+							BOOST_CHECK_EQUAL(u[j],v1[j] * e);
+						}
+					} else {
+						BOOST_CHECK_THROW(k1.pow(e,vs),std::invalid_argument);
+					}
+				}
+				// Integral power substitution on the last symbol.
+				const symbol &s = *(vs.end() - 1);
+				const auto ret = k1.ipow_subs(s,integer(2),integer(1),vs);
+				auto u_ref = v1;
+				if (u_ref[i - 1u] >= 2) {
+					u_ref[i - 1u] = static_cast<T>(u_ref[i - 1u] % 2);
+				}
+				BOOST_CHECK(ret.second == k_type(u_ref.begin(),u_ref.end()));
+			}
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(kronecker_monomial_packed_test)
+{
+	boost::mpl::for_each<int_types>(packed_tester());
+}
+
 struct equality_tester
 {
 	template <typename T>
@@ -944,3 +1096,82 @@ BOOST_AUTO_TEST_CASE(kronecker_monomial_type_traits_test)
 {
 	boost::mpl::for_each<int_types>(tt_tester());
 }
+
+#if defined(PIRANHA_INT128_T)
+
+BOOST_AUTO_TEST_CASE(kronecker_monomial_int128_test)
+{
+	typedef PIRANHA_INT128_T int_type;
+	typedef kronecker_monomial<int_type> k_type;
+	typedef kronecker_array<int_type> ka;
+	BOOST_CHECK(is_key<k_type>::value);
+	BOOST_CHECK(key_has_degree<k_type>::value);
+	symbol_set vs;
+	for (char c = 'a'; c < 'a' + 12; ++c) {
+		vs.add(symbol(std::string(1u,c)));
+	}
+	// Exponents which would overflow a 64-bit Kronecker code in 12 variables.
+	const auto &M = std::get<0u>(ka::get_limits()[12u]);
+	std::vector<int> v1{100,-3,0,1,2,3,4,5,6,7,8,50}, v2{-100,1,1,1,1,1,1,1,1,1,1,-49};
+	BOOST_CHECK_THROW((kronecker_monomial<long long>(v1.begin(),v1.end())),std::invalid_argument);
+	const k_type k1(v1.begin(),v1.end()), k2(v2.begin(),v2.end());
+	const auto u1 = k1.unpack(vs);
+	for (std::size_t i = 0u; i < v1.size(); ++i) {
+		BOOST_CHECK(u1[static_cast<typename k_type::v_type::size_type>(i)] == v1[i]);
+	}
+	// Arithmetic.
+	k_type res;
+	k1.multiply(res,k2,vs);
+	auto u = res.unpack(vs);
+	for (std::size_t i = 0u; i < v1.size(); ++i) {
+		BOOST_CHECK(u[static_cast<typename k_type::v_type::size_type>(i)] == v1[i] + v2[i]);
+	}
+	res.divide(res,k2,vs);
+	BOOST_CHECK(res == k1);
+	BOOST_CHECK(detail::ka_to_integer(k1.degree(vs)) == 183);
+	BOOST_CHECK(detail::ka_to_integer(k1.degree({"a","l"},vs)) == 150);
+	u = k1.pow(2,vs).unpack(vs);
+	for (std::size_t i = 0u; i < v1.size(); ++i) {
+		BOOST_CHECK(u[static_cast<typename k_type::v_type::size_type>(i)] == 2 * v1[i]);
+	}
+	const k_type k_max{M[0u],int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),
+		int_type(0),int_type(0),int_type(0)};
+	BOOST_CHECK_THROW(k_max.pow(2,vs),std::invalid_argument);
+	BOOST_CHECK_THROW(k_max.multiply(res,k_max,vs),std::invalid_argument);
+	// Hashing: the hash is the code reduced modulo 2**N.
+	BOOST_CHECK_EQUAL(k1.hash(),static_cast<std::size_t>(k1.get_int()));
+	k1.multiply(res,k2,vs);
+	BOOST_CHECK_EQUAL(static_cast<std::size_t>(k1.hash() + k2.hash()),res.hash());
+	BOOST_CHECK_EQUAL(std::hash<k_type>()(k1),k1.hash());
+	// Printing.
+	std::ostringstream oss;
+	k1.print(oss,vs);
+	BOOST_CHECK_EQUAL(oss.str(),"a**100*b**-3*d*e**2*f**3*g**4*h**5*i**6*j**7*k**8*l**50");
+	oss.str("");
+	k_type{int_type(0),int_type(-3),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),int_type(0),
+		int_type(0),int_type(0),int_type(200)}.print_tex(oss,vs);
+	BOOST_CHECK_EQUAL(oss.str(),"\\frac{{l}^{200}}{{b}^{3}}");
+	// Calculus and substitution.
+	const auto p = k1.partial(symbol("a"),vs);
+	BOOST_CHECK_EQUAL(p.first,100);
+	BOOST_CHECK(p.second.unpack(vs)[0u] == 99);
+	const auto in = k1.integrate(symbol("l"),vs);
+	BOOST_CHECK_EQUAL(in.first,51);
+	BOOST_CHECK(in.second.unpack(vs)[11u] == 51);
+	std::unordered_map<symbol,integer> dict;
+	for (const auto &s: vs) {
+		dict[s] = 1;
+	}
+	dict[symbol("a")] = 2;
+	BOOST_CHECK_EQUAL(k1.evaluate(dict,vs),integer(2).pow(100u));
+	const auto s = k1.subs(symbol("l"),integer(2),vs);
+	BOOST_CHECK_EQUAL(s.first,integer(2).pow(50u));
+	auto vs2(vs);
+	vs2.remove(symbol("l"));
+	BOOST_CHECK(s.second.unpack(vs2)[0u] == 100);
+	const auto is = k1.ipow_subs(symbol("a"),integer(3),integer(2),vs);
+	BOOST_CHECK_EQUAL(is.first,integer(2).pow(33u));
+	BOOST_CHECK(is.second.unpack(vs)[0u] == 1);
+}
+
+#endif
@@ -28,8 +28,10 @@
 #include <cstddef>
 #include <limits>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 
 #include "../src/environment.hpp"
 #include "../src/math.hpp"
@@ -38,6 +40,7 @@
 #include "../src/kronecker_array.hpp"
 #include "../src/kronecker_monomial.hpp"
 #include "../src/settings.hpp"
+#include "../src/tuning.hpp"
 
 using namespace piranha;
 
@@ -206,3 +209,83 @@ BOOST_AUTO_TEST_CASE(kronecker_polynomial_sparse_cancellation_mt_test)
 	auto retval = f * h;
 	BOOST_CHECK_EQUAL(retval.size(),5786u);
 }
+
+// Multi-modular multiplication.
+BOOST_AUTO_TEST_CASE(kronecker_polynomial_crt_test)
+{
+	typedef polynomial<integer,kronecker_monomial<>> p_type;
+	p_type x("x"), y("y"), z("z"), t("t");
+	for (unsigned n_threads = 1u; n_threads <= 4u; ++n_threads) {
+		settings::set_n_threads(n_threads);
+		// Small coefficients, with cancellations and negative values.
+		auto f = math::pow(1 + x + y + z + t,6), g = math::pow(1 - x + y - z + t,6);
+		const auto ref1 = f * g;
+		// Large coefficients, requiring more than one prime.
+		auto h = math::pow(f * integer("12345678901234567890") - 1,2);
+		const auto ref2 = h * (h + 1);
+		// Coefficients too large for the available primes.
+		const auto huge = math::pow(integer(10),200) * x + 1;
+		const auto ref3 = huge * huge;
+		tuning::set_crt_multiplication(true);
+		BOOST_CHECK_EQUAL(f * g,ref1);
+		BOOST_CHECK_EQUAL(h * (h + 1),ref2);
+		BOOST_CHECK_EQUAL(-h * (h + 1),-ref2);
+		BOOST_CHECK_EQUAL(huge * huge,ref3);
+		BOOST_CHECK_EQUAL(f * p_type{},p_type{});
+		tuning::set_crt_multiplication(false);
+	}
+	settings::set_n_threads(1u);
+}
+
+#if defined(PIRANHA_INT128_T)
+
+// 128-bit Kronecker codes, in a number of variables and with exponents beyond the 64-bit limits.
+BOOST_AUTO_TEST_CASE(kronecker_polynomial_int128_test)
+{
+	typedef polynomial<integer,kronecker_monomial<PIRANHA_INT128_T>> p_type;
+	typedef polynomial<integer,short> p_type_ref;
+	typedef polynomial<integer,kronecker_monomial<long long>> p_type_ll;
+	std::unordered_map<std::string,integer> dict;
+	p_type f(1), g;
+	p_type_ref f_ref(1), g_ref;
+	p_type_ll f_ll(1);
+	for (int i = 0; i < 12; ++i) {
+		const std::string name = std::string("x") + static_cast<char>('a' + i);
+		f += (i + 1) * math::pow(p_type(name),20 + i);
+		f_ref += (i + 1) * math::pow(p_type_ref(name),20 + i);
+		f_ll += (i + 1) * p_type_ll(name);
+		dict[name] = integer(i % 2 ? -(i + 1) : i + 2);
+	}
+	BOOST_CHECK_THROW(math::pow(p_type_ll("xa"),20) * f_ll,std::invalid_argument);
+	f = math::pow(f,3);
+	f_ref = math::pow(f_ref,3);
+	g = f - math::pow(p_type("xa"),60);
+	g_ref = f_ref - math::pow(p_type_ref("xa"),60);
+	const auto ref = f_ref * g_ref;
+	const auto ref_value = math::evaluate(ref,dict);
+	for (unsigned n_threads = 1u; n_threads <= 4u; ++n_threads) {
+		settings::set_n_threads(n_threads);
+		const auto res = f * g;
+		BOOST_CHECK_EQUAL(res.size(),ref.size());
+		BOOST_CHECK_EQUAL(math::evaluate(res,dict),ref_value);
+	}
+	// Dense case, checked against 64-bit codes.
+	p_type x("x"), y("y"), z("z");
+	p_type_ll x_ll("x"), y_ll("y"), z_ll("z");
+	dict["x"] = 3;
+	dict["y"] = -2;
+	dict["z"] = 5;
+	const auto h = math::pow(1 + x + math::pow(y,3) + z,20);
+	const auto h_ll = math::pow(1 + x_ll + math::pow(y_ll,3) + z_ll,20);
+	const auto dense_ref = h_ll * (h_ll + 1);
+	const auto dense_ref_value = math::evaluate(dense_ref,dict);
+	for (unsigned n_threads = 1u; n_threads <= 4u; ++n_threads) {
+		settings::set_n_threads(n_threads);
+		const auto res = h * (h + 1);
+		BOOST_CHECK_EQUAL(res.size(),dense_ref.size());
+		BOOST_CHECK_EQUAL(math::evaluate(res,dict),dense_ref_value);
+	}
+	settings::set_n_threads(1u);
+}
+
+#endif
@@ -0,0 +1,205 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+
+#include "../src/modular_integer.hpp"
+
+#define BOOST_TEST_MODULE modular_integer_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "../src/environment.hpp"
+#include "../src/exceptions.hpp"
+#include "../src/kronecker_monomial.hpp"
+#include "../src/math.hpp"
+#include "../src/mp_integer.hpp"
+#include "../src/polynomial.hpp"
+#include "../src/type_traits.hpp"
+
+static std::mt19937 rng;
+static const int ntries = 1000;
+
+using namespace piranha;
+
+using mi7 = modular_integer<7ul>;
+using mi_big = modular_integer<2147483647ul>;
+
+// Reference reduction via mp_integer.
+static std::uint_least32_t ref_mod(const integer &n, std::uint_least32_t p)
+{
+	integer r = n % p;
+	if (r.sign() < 0) {
+		r += p;
+	}
+	return static_cast<std::uint_least32_t>(r);
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_constructors_test)
+{
+	environment env;
+	BOOST_CHECK_EQUAL(mi7{}.get_value(),0u);
+	BOOST_CHECK_EQUAL(mi7::modulus,7u);
+	BOOST_CHECK_EQUAL(mi7{3}.get_value(),3u);
+	BOOST_CHECK_EQUAL(mi7{10}.get_value(),3u);
+	BOOST_CHECK_EQUAL(mi7{-1}.get_value(),6u);
+	BOOST_CHECK_EQUAL(mi7{-14}.get_value(),0u);
+	BOOST_CHECK_EQUAL(mi7{char(9)}.get_value(),2u);
+	BOOST_CHECK_EQUAL(mi7{std::numeric_limits<long long>::min()}.get_value(),
+		ref_mod(integer(std::numeric_limits<long long>::min()),7u));
+	BOOST_CHECK_EQUAL(mi7{std::numeric_limits<unsigned long long>::max()}.get_value(),
+		ref_mod(integer(std::numeric_limits<unsigned long long>::max()),7u));
+	BOOST_CHECK_EQUAL(mi_big{2147483647ll}.get_value(),0u);
+	BOOST_CHECK_EQUAL(mi_big{-2147483648ll}.get_value(),2147483646u);
+	const integer n = math::pow(integer(3),100);
+	BOOST_CHECK_EQUAL(mi_big{n}.get_value(),ref_mod(n,2147483647u));
+	BOOST_CHECK_EQUAL(mi_big{-n}.get_value(),ref_mod(-n,2147483647u));
+	mi7 m;
+	m = 15;
+	BOOST_CHECK_EQUAL(m.get_value(),1u);
+	m = integer(-15);
+	BOOST_CHECK_EQUAL(m.get_value(),6u);
+	BOOST_CHECK((!std::is_constructible<mi7,double>::value));
+	BOOST_CHECK((!std::is_constructible<mi7,bool>::value));
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_arithmetic_test)
+{
+	std::uniform_int_distribution<long long> dist(-(1ll << 40),1ll << 40);
+	for (int i = 0; i < ntries; ++i) {
+		const long long a = dist(rng), b = dist(rng);
+		const mi_big ma{a}, mb{b};
+		const integer ia(a), ib(b);
+		BOOST_CHECK_EQUAL((ma + mb).get_value(),ref_mod(ia + ib,2147483647u));
+		BOOST_CHECK_EQUAL((ma - mb).get_value(),ref_mod(ia - ib,2147483647u));
+		BOOST_CHECK_EQUAL((ma * mb).get_value(),ref_mod(ia * ib,2147483647u));
+		BOOST_CHECK_EQUAL((-ma).get_value(),ref_mod(-ia,2147483647u));
+		BOOST_CHECK_EQUAL((ma * b).get_value(),ref_mod(ia * ib,2147483647u));
+		BOOST_CHECK_EQUAL((a + mb).get_value(),ref_mod(ia + ib,2147483647u));
+		BOOST_CHECK_EQUAL((ia - mb).get_value(),ref_mod(ia - ib,2147483647u));
+		if (!mb.is_zero()) {
+			BOOST_CHECK_EQUAL((ma / mb) * mb,ma);
+		}
+		mi_big acc{a};
+		acc.multiply_accumulate(ma,mb);
+		BOOST_CHECK_EQUAL(acc.get_value(),ref_mod(ia + ia * ib,2147483647u));
+	}
+	mi7 m{5};
+	m += 4;
+	BOOST_CHECK_EQUAL(m,2);
+	m -= mi7{3};
+	BOOST_CHECK_EQUAL(m,-1);
+	m *= integer(3);
+	BOOST_CHECK_EQUAL(m,4);
+	m /= 2;
+	BOOST_CHECK_EQUAL(m,2);
+	BOOST_CHECK(m == 9);
+	BOOST_CHECK(9 == m);
+	BOOST_CHECK(m != 3);
+	BOOST_CHECK(integer(3) != m);
+	BOOST_CHECK_EQUAL(+m,m);
+	BOOST_CHECK_THROW(m / 0,zero_division_error);
+	BOOST_CHECK_THROW(m /= mi7{7},zero_division_error);
+	BOOST_CHECK((std::is_same<decltype(m + 1),mi7>::value));
+	BOOST_CHECK((std::is_same<decltype(integer(1) * m),mi7>::value));
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_pow_test)
+{
+	BOOST_CHECK_EQUAL(mi7{3}.pow(0),1);
+	BOOST_CHECK_EQUAL(mi7{3}.pow(6),1);
+	BOOST_CHECK_EQUAL(mi7{3}.pow(2),2);
+	BOOST_CHECK_EQUAL(mi7{3}.pow(-1),5);
+	BOOST_CHECK_EQUAL(mi7{3}.pow(-1) * 3,1);
+	BOOST_CHECK_EQUAL(mi7{}.pow(0),1);
+	BOOST_CHECK_EQUAL(mi7{}.pow(3u),0);
+	BOOST_CHECK_THROW(mi7{}.pow(-1),zero_division_error);
+	BOOST_CHECK_THROW(mi7{}.inverse(),zero_division_error);
+	const integer e = math::pow(integer(10),30);
+	BOOST_CHECK_EQUAL(mi_big{12345}.pow(e),mi_big{12345}.pow(static_cast<long long>(e % 2147483646)));
+	BOOST_CHECK_EQUAL(mi_big{12345}.pow(-e) * mi_big{12345}.pow(e),1);
+	BOOST_CHECK_EQUAL(math::pow(mi_big{2},31),1);
+	BOOST_CHECK_EQUAL(math::pow(mi_big{2},integer(30)).get_value(),1u << 30u);
+	for (int i = 0; i < ntries; ++i) {
+		const mi_big x{std::uniform_int_distribution<long long>(1,2147483646)(rng)};
+		BOOST_CHECK_EQUAL(x * x.inverse(),1);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_math_test)
+{
+	mi7 x{2};
+	math::negate(x);
+	BOOST_CHECK_EQUAL(x,5);
+	BOOST_CHECK(math::is_zero(mi7{14}));
+	BOOST_CHECK(!math::is_zero(x));
+	BOOST_CHECK_EQUAL(math::partial(x,"x"),0);
+	BOOST_CHECK_EQUAL(math::evaluate(x,std::unordered_map<std::string,double>{{"x",3.}}),5);
+	BOOST_CHECK_EQUAL(math::subs(x,"x",3.),5);
+	BOOST_CHECK_EQUAL(math::ipow_subs(x,"x",integer(2),3.),5);
+	mi7 z{1};
+	math::multiply_accumulate(z,mi7{2},mi7{3});
+	BOOST_CHECK_EQUAL(z,0);
+	BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(mi7{-1}),"6");
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_type_traits_test)
+{
+	BOOST_CHECK(is_cf<mi7>::value);
+	BOOST_CHECK(is_cf<mi_big>::value);
+	BOOST_CHECK(std::is_trivially_copyable<mi_big>::value);
+	BOOST_CHECK(std::is_nothrow_move_constructible<mi_big>::value);
+	BOOST_CHECK(is_differentiable<mi7>::value);
+	BOOST_CHECK(has_negate<mi7>::value);
+	BOOST_CHECK(is_ostreamable<mi7>::value);
+	BOOST_CHECK(is_equality_comparable<mi7>::value);
+	BOOST_CHECK((is_addable<mi7,integer>::value));
+	BOOST_CHECK((is_addable<int,mi7>::value));
+	BOOST_CHECK((!is_addable<mi7,double>::value));
+	BOOST_CHECK((!is_addable<mi7,mi_big>::value));
+	BOOST_CHECK(has_multiply_accumulate<mi_big>::value);
+}
+
+BOOST_AUTO_TEST_CASE(modular_integer_polynomial_test)
+{
+	using p_type = polynomial<mi_big,kronecker_monomial<>>;
+	using pi_type = polynomial<integer,kronecker_monomial<>>;
+	p_type x{"x"}, y{"y"}, z{"z"};
+	pi_type xi{"x"}, yi{"y"}, zi{"z"};
+	auto f = math::pow(x + y + z + 1,8) * 12345;
+	auto fi = math::pow(xi + yi + zi + 1,8) * 12345;
+	auto prod = f * (f + 1);
+	auto prodi = fi * (fi + 1);
+	BOOST_CHECK_EQUAL(prod.size(),prodi.size());
+	BOOST_CHECK_EQUAL(prod,p_type{prodi});
+	// Coefficients that vanish modulo the prime are dropped.
+	BOOST_CHECK_EQUAL(p_type{xi * 2147483647 + yi},y);
+	// Characteristic of the field.
+	using p7_type = polynomial<mi7,kronecker_monomial<>>;
+	p7_type a{"a"}, b{"b"};
+	BOOST_CHECK_EQUAL(math::pow(a + b,7),math::pow(a,7) + math::pow(b,7));
+	BOOST_CHECK_EQUAL((a + b) * 7,0);
+}
@@ -27,6 +27,7 @@
 #include <boost/mpl/vector.hpp>
 #include <cstddef>
 #include <initializer_list>
+#include <limits>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -380,6 +381,12 @@ struct degree_tester
 			BOOST_CHECK(k3.degree({"A","B","C"},v) == T(0));
 			BOOST_CHECK(k3.degree({"x","y","z"},v) == T(0));
 			BOOST_CHECK(k3.degree({"x","y","z","A","B","C","a"},v) == T(2));
+			// Partial degree from positions.
+			BOOST_CHECK(k3.degree(symbol_set::positions(v,{"a","c","A","z"}),v) == T(4) + T(2));
+			BOOST_CHECK(k3.degree(symbol_set::positions(v,{"x","y"}),v) == T(0));
+			BOOST_CHECK(k3.ldegree(symbol_set::positions(v,{"c","b"}),v) == T(4) + T(3));
+			BOOST_CHECK_THROW(k3.degree(symbol_set::positions(v,{"c"}),symbol_set{}),std::invalid_argument);
+			BOOST_CHECK_THROW(k2.degree(symbol_set::positions(v,{"c"}),symbol_set({symbol("a"),symbol("b")})),std::invalid_argument);
 		}
 	};
 	template <typename T>
@@ -406,7 +413,41 @@ struct multiply_tester
 			symbol_set vs;
 			k_type k1({0}), k2({1}), retval;
 			BOOST_CHECK_THROW(k1.multiply(retval,k2,vs),std::invalid_argument);
+			vs.add("x");
+			vs.add("y");
+			vs.add("z");
+			k1 = k_type{T(1),T(-2),T(3)};
+			k2 = k_type{T(4),T(5),T(-6)};
+			k1.multiply(retval,k2,vs);
+			BOOST_CHECK(retval == (k_type{T(5),T(3),T(-3)}));
+			// Multiplication in place.
+			k1.multiply(k1,k2,vs);
+			BOOST_CHECK(k1 == retval);
+			k2 = k_type{T(1),T(2)};
+			BOOST_CHECK_THROW(k1.multiply(retval,k2,vs),std::invalid_argument);
+			overflow_check<T,U>(vs);
+		}
+		template <typename T2, typename U2>
+		static void overflow_check(const symbol_set &vs, typename std::enable_if<std::is_integral<T2>::value>::type * = nullptr)
+		{
+			typedef monomial<T2,U2> k_type;
+			k_type retval;
+			k_type k1{T2(0),std::numeric_limits<T2>::max(),T2(0)}, k2{T2(0),T2(1),T2(0)};
+			BOOST_CHECK_THROW(k1.multiply(retval,k2,vs),std::overflow_error);
+			k1 = k_type{T2(0),T2(0),std::numeric_limits<T2>::min()};
+			k2 = k_type{T2(0),T2(0),T2(-1)};
+			BOOST_CHECK_THROW(k1.multiply(retval,k2,vs),std::overflow_error);
+			k1 = k_type{std::numeric_limits<T2>::max(),std::numeric_limits<T2>::min(),T2(0)};
+			k2 = k_type{std::numeric_limits<T2>::min(),std::numeric_limits<T2>::max(),T2(0)};
+			k1.multiply(retval,k2,vs);
+			BOOST_CHECK(retval == (k_type{T2(-1),T2(-1),T2(0)}));
+			// Check the degree as well.
+			k1 = k_type{T2(1),T2(-3),T2(7)};
+			BOOST_CHECK_EQUAL(k1.degree(vs),T2(5));
 		}
+		template <typename T2, typename U2>
+		static void overflow_check(const symbol_set &, typename std::enable_if<!std::is_integral<T2>::value>::type * = nullptr)
+		{}
 	};
 	template <typename T>
 	void operator()(const T &)
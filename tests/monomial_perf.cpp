@@ -0,0 +1,134 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "../src/monomial.hpp"
+
+#define BOOST_TEST_MODULE monomial_test
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/timer/timer.hpp>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "../src/environment.hpp"
+#include "../src/symbol_set.hpp"
+
+using namespace piranha;
+
+// Number of monomials in the test vectors.
+static const std::size_t n_monos = 1000000ull;
+
+// Element-wise operations on monomials with integral exponents: scalar loops over the elements vs the
+// branch-free kernels used by multiply(), operator==() and degree().
+struct kernel_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef monomial<T> m_type;
+		std::mt19937 rng;
+		std::uniform_int_distribution<int> dist(0,10);
+		for (unsigned size: {4u,8u,16u}) {
+			std::cout << "Type: " << typeid(T).name() << ", size: " << size << '\n';
+			symbol_set args;
+			for (unsigned i = 0u; i < size; ++i) {
+				args.add(std::string("x") + std::to_string(i));
+			}
+			std::vector<m_type> v1, v2;
+			for (std::size_t i = 0u; i < n_monos; ++i) {
+				m_type m1, m2;
+				for (unsigned j = 0u; j < size; ++j) {
+					const T e = static_cast<T>(dist(rng));
+					m1.push_back(e);
+					// Make the two monomials equal with high probability.
+					m2.push_back(dist(rng) ? e : static_cast<T>(dist(rng)));
+				}
+				v1.push_back(m1);
+				v2.push_back(m2);
+			}
+			m_type retval(args);
+			long long acc = 0;
+			{
+				std::cout << "Scalar addition: ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					std::transform(v1[i].begin(),v1[i].end(),v2[i].begin(),retval.begin(),[](const T &a, const T &b) {
+						return static_cast<T>(a + b);
+					});
+					acc += retval[0u];
+				}
+			}
+			{
+				std::cout << "multiply(): ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					v1[i].multiply(retval,v2[i],args);
+					acc -= retval[0u];
+				}
+			}
+			{
+				std::cout << "Scalar equality: ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					acc += std::equal(v1[i].begin(),v1[i].end(),v2[i].begin());
+				}
+			}
+			{
+				std::cout << "operator==(): ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					acc -= (v1[i] == v2[i]);
+				}
+			}
+			{
+				std::cout << "Scalar degree: ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					T d(0);
+					for (const auto &e: v1[i]) {
+						d = static_cast<T>(d + e);
+					}
+					acc += d;
+				}
+			}
+			{
+				std::cout << "degree(): ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t i = 0u; i < n_monos; ++i) {
+					acc -= v1[i].degree(args);
+				}
+			}
+			std::cout << "Checksum: " << acc << "\n\n";
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(monomial_kernel_test)
+{
+	environment env;
+	boost::mpl::for_each<boost::mpl::vector<signed char,short,int,long long>>(kernel_tester());
+}
@@ -26,6 +26,7 @@
 #define FUSION_MAX_VECTOR_SIZE 20
 
 #include <algorithm>
+#include <atomic>
 #include <boost/fusion/algorithm.hpp>
 #include <boost/fusion/include/algorithm.hpp>
 #include <boost/fusion/include/sequence.hpp>
@@ -38,6 +39,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -48,6 +50,8 @@
 #include "../src/environment.hpp"
 #include "../src/exceptions.hpp"
 #include "../src/math.hpp"
+#include "../src/settings.hpp"
+#include "../src/tracing.hpp"
 #include "../src/type_traits.hpp"
 
 using integral_types = boost::mpl::vector<char,
@@ -2259,6 +2263,59 @@ BOOST_AUTO_TEST_CASE(mp_integer_factorial_test)
 	boost::mpl::for_each<size_types>(factorial_tester());
 }
 
+struct binomial_cache_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef mp_integer<T::value> int_type;
+		using cache = detail::binomial_cache<T::value>;
+		settings::set_tracing(true);
+		tracing::reset();
+		mpz_raii m;
+		// Run over the cache limits, in reverse order so that the first lookups grow the tables.
+		for (unsigned n = cache::max_factorial + 5u; n-- > 0u;) {
+			::mpz_fac_ui(&m.m_mpz,n);
+			BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(int_type(n).factorial()),mpz_lexcast(m));
+		}
+		for (unsigned n = cache::max_binomial + 5u; n-- > 0u;) {
+			for (unsigned k = 0u; k < n + 3u; ++k) {
+				::mpz_set_ui(&m.m_mpz,n);
+				::mpz_bin_ui(&m.m_mpz,&m.m_mpz,k);
+				BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(int_type(n).binomial(k)),mpz_lexcast(m));
+			}
+		}
+		BOOST_CHECK(boost::any_cast<unsigned long long>(tracing::get("binomial_cache_hits")) > 0u);
+		BOOST_CHECK(boost::any_cast<unsigned long long>(tracing::get("binomial_cache_misses")) > 0u);
+		settings::set_tracing(false);
+		tracing::reset();
+	}
+};
+
+BOOST_AUTO_TEST_CASE(mp_integer_binomial_cache_test)
+{
+	boost::mpl::for_each<size_types>(binomial_cache_tester());
+	// Concurrent lookups.
+	std::vector<std::thread> threads;
+	std::atomic<bool> flag(true);
+	for (unsigned i = 0u; i < 4u; ++i) {
+		threads.emplace_back([&flag,i]() {
+			for (unsigned n = i; n < 300u; n += 4u) {
+				if (n && integer(n).factorial() != integer(n - 1u).factorial() * n) {
+					flag.store(false);
+				}
+				if (n > 1u && integer(n).binomial(n / 2u) != integer(n - 1u).binomial(n / 2u) + integer(n - 1u).binomial(n / 2u - 1u)) {
+					flag.store(false);
+				}
+			}
+		});
+	}
+	for (auto &t: threads) {
+		t.join();
+	}
+	BOOST_CHECK(flag.load());
+}
+
 struct binomial_tester
 {
 	template <typename T>
@@ -2594,3 +2651,76 @@ BOOST_AUTO_TEST_CASE(mp_integer_ipow_subs_test)
 {
 	boost::mpl::for_each<size_types>(ipow_subs_tester());
 }
+
+struct conversion_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef mp_integer<T::value> int_type;
+		// A mix of static and dynamic values, including the extremes of the static representation.
+		std::vector<int_type> values{int_type(0),int_type(1),int_type(-1),int_type(42),int_type(-42)};
+		const auto lmax = std::numeric_limits<long long>::max(), lmin = std::numeric_limits<long long>::min();
+		values.push_back(int_type(lmax));
+		values.push_back(int_type(lmin));
+		values.push_back(int_type(lmax) * lmax);
+		values.push_back(int_type(lmin) * lmax);
+		values.push_back(int_type(lmax) * lmax * lmax * lmax);
+		values.push_back(-values.back());
+		std::uniform_int_distribution<long long> dist(lmin,lmax);
+		for (int i = 0; i < ntries; ++i) {
+			int_type tmp(dist(rng));
+			const auto n = i % 4;
+			for (int j = 0; j < n; ++j) {
+				tmp *= dist(rng);
+			}
+			values.push_back(tmp);
+		}
+		// A small value in dynamic storage.
+		values.push_back(int_type(42));
+		values.back().promote();
+		// Decimal conversion, with a shared buffer.
+		std::string buffer;
+		for (const auto &n: values) {
+			buffer.clear();
+			n.to_decimal(buffer);
+			BOOST_CHECK_EQUAL(buffer,boost::lexical_cast<std::string>(n));
+			BOOST_CHECK_EQUAL(int_type::from_decimal(buffer.data(),buffer.data() + buffer.size()),n);
+			BOOST_CHECK_EQUAL(int_type(buffer),n);
+		}
+		buffer = "123abc";
+		BOOST_CHECK_EQUAL(int_type::from_decimal(buffer.data(),buffer.data() + 3),123);
+		BOOST_CHECK_THROW(int_type::from_decimal(buffer.data(),buffer.data() + 4),std::invalid_argument);
+		BOOST_CHECK_THROW(int_type::from_decimal(buffer.data(),buffer.data()),std::invalid_argument);
+		BOOST_CHECK_THROW(int_type("-"),std::invalid_argument);
+		BOOST_CHECK_THROW(int_type("01"),std::invalid_argument);
+		BOOST_CHECK_THROW(int_type("-0"),std::invalid_argument);
+		BOOST_CHECK_EQUAL(int_type("-123"),-123);
+		// Binary conversion, all values in the same buffer.
+		buffer.clear();
+		for (const auto &n: values) {
+			n.to_binary(buffer);
+		}
+		const char *begin = buffer.data(), *end = buffer.data() + buffer.size();
+		for (const auto &n: values) {
+			const auto tmp = int_type::from_binary(begin,end);
+			BOOST_CHECK_EQUAL(tmp,n);
+			if (n.is_static()) {
+				BOOST_CHECK(tmp.is_static());
+			}
+		}
+		BOOST_CHECK(begin == end);
+		BOOST_CHECK_THROW(int_type::from_binary(begin,end),std::invalid_argument);
+		// Truncated input.
+		buffer.clear();
+		(int_type(lmax) * lmax).to_binary(buffer);
+		begin = buffer.data();
+		end = buffer.data() + buffer.size() - 1u;
+		BOOST_CHECK_THROW(int_type::from_binary(begin,end),std::invalid_argument);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(mp_integer_conversion_test)
+{
+	boost::mpl::for_each<size_types>(conversion_tester());
+}
@@ -1983,8 +1983,14 @@ struct binomial_tester
 		BOOST_CHECK_EQUAL(math::binomial(q_type{2,3},q_type{3,4}),math::binomial(2./3.,3./4.));
 		BOOST_CHECK_EQUAL(math::binomial(1.2,q_type{3,4}),math::binomial(1.2,3./4.));
 		BOOST_CHECK_EQUAL(math::binomial(q_type{3,4},1.2),math::binomial(3./4.,1.2));
-		// NOTE: cannot really do random testing at the moment as the implementation of
-		// generic_binomial is way too slow.
+		// Random testing against the generic implementation.
+		std::uniform_int_distribution<int> num_dist(-100,100), den_dist(1,20), k_dist(0,30);
+		for (int i = 0; i < 100; ++i) {
+			const q_type x(num_dist(rng),den_dist(rng));
+			const int k = k_dist(rng);
+			BOOST_CHECK_EQUAL(x.binomial(k),detail::generic_binomial(x,k));
+			BOOST_CHECK_EQUAL(x.binomial(int_type(k)),detail::generic_binomial(x,k));
+		}
 	}
 };
 
@@ -27,6 +27,7 @@
 #include <boost/mpl/for_each.hpp>
 #include <boost/mpl/vector.hpp>
 #include <cstddef>
+#include <functional>
 #include <limits>
 #include <map>
 #include <stdexcept>
@@ -39,6 +40,7 @@
 #include "../src/debug_access.hpp"
 #include "../src/environment.hpp"
 #include "../src/forwarding.hpp"
+#include "../src/kronecker_monomial.hpp"
 #include "../src/math.hpp"
 #include "../src/mp_integer.hpp"
 #include "../src/mp_rational.hpp"
@@ -688,3 +690,40 @@ BOOST_AUTO_TEST_CASE(polynomial_ipow_subs_test)
 	BOOST_CHECK_EQUAL(math::ipow_subs(x.pow(-7) + y + z,"x",integer(-2),y),x.pow(-1) * y.pow(3) + y + z);
 	BOOST_CHECK_EQUAL(math::ipow_subs(x.pow(-7) + y + z,"x",integer(-7),z),y + 2*z);
 }
+
+// Check the grouped substitution against the term-by-term substitution, with different numbers of threads.
+struct grouped_subs_tester
+{
+	template <typename Key>
+	void operator()(const Key &)
+	{
+		typedef polynomial<rational,Key> p_type;
+		p_type x{"x"}, y{"y"}, z{"z"};
+		const auto f = math::pow(1 - x + 2 * y + z,20) + x.pow(-1) * y;
+		auto term_by_term = [&f](const std::function<p_type(const p_type &)> &func) {
+			p_type retval;
+			for (const auto &t: f) {
+				retval += t.first * func(t.second);
+			}
+			return retval;
+		};
+		for (unsigned n = 1u; n <= 4u; ++n) {
+			settings::set_n_threads(n);
+			BOOST_CHECK_EQUAL(f.subs("y",rational(-3,2)),term_by_term([](const p_type &p) {return p.subs("y",rational(-3,2));}));
+			BOOST_CHECK_EQUAL(f.subs("y",x - z),term_by_term([&x,&z](const p_type &p) {return p.subs("y",x - z);}));
+			BOOST_CHECK_EQUAL(f.subs("x",y),term_by_term([&y](const p_type &p) {return p.subs("x",y);}));
+			BOOST_CHECK_EQUAL(f.subs("t",y),f);
+			BOOST_CHECK_EQUAL(f.ipow_subs("y",integer(3),x + 2),term_by_term([&x](const p_type &p) {
+				return p.ipow_subs("y",integer(3),x + 2);}));
+			BOOST_CHECK_EQUAL(f.ipow_subs("x",integer(-1),z),term_by_term([&z](const p_type &p) {return p.ipow_subs("x",integer(-1),z);}));
+			BOOST_CHECK_EQUAL(f.ipow_subs("z",integer(2),rational(1,3)),term_by_term([](const p_type &p) {
+				return p.ipow_subs("z",integer(2),rational(1,3));}));
+		}
+		settings::reset_n_threads();
+	}
+};
+
+BOOST_AUTO_TEST_CASE(polynomial_grouped_subs_test)
+{
+	boost::mpl::for_each<boost::mpl::vector<int,kronecker_monomial<>>>(grouped_subs_tester());
+}
@@ -1814,6 +1814,22 @@ BOOST_AUTO_TEST_CASE(real_fma_test)
 	r4 = real{".2",500};
 	r4.multiply_accumulate(real{"-.2",200},real{".2",200});
 	BOOST_CHECK((real{".2",500} + real{"-.2",200} * real{".2",200} != r4));
+	// Precision promotion in the in-place operators must preserve the value.
+	real r5{"1.1",20};
+	r5 += real{"1",100};
+	BOOST_CHECK_EQUAL(r5.get_prec(),::mpfr_prec_t(100));
+	BOOST_CHECK_EQUAL(r5,(real{"1.1",20} + real{"1",100}));
+	r5 = real{"1.1",20};
+	r5.multiply_accumulate(real{"1",100},real{"1",100});
+	BOOST_CHECK_EQUAL(r5.get_prec(),::mpfr_prec_t(100));
+	BOOST_CHECK_EQUAL(r5,(real{"1.1",20} + real{1,100}));
+	// Repeated accumulation with uniform precision.
+	real r6{0,64};
+	for (int i = 0; i < 100; ++i) {
+		r6.multiply_accumulate(real{i,64},real{2,64});
+	}
+	BOOST_CHECK_EQUAL(r6,9900);
+	BOOST_CHECK_EQUAL(r6.get_prec(),::mpfr_prec_t(64));
 }
 
 BOOST_AUTO_TEST_CASE(real_sin_cos_test)
@@ -2133,3 +2149,48 @@ BOOST_AUTO_TEST_CASE(real_literal_test)
 	}
 	BOOST_CHECK_EQUAL(1.e-1_r,real{"1e-1"});
 }
+
+BOOST_AUTO_TEST_CASE(real_bulk_conversion_test)
+{
+	std::vector<real> values{real(0),real("-0"),real(1),real(-1),real("1.1",4),real("-1.1",200),real("1e-300",70),
+		real("3.14159265358979323846264338327950288",500),real("-123456789e1000"),real("nan"),real("inf"),real("-inf",32)};
+	std::mt19937 eng;
+	std::uniform_real_distribution<double> dist(-1E10,1E10);
+	for (int i = 0; i < 1000; ++i) {
+		values.emplace_back(dist(eng),static_cast< ::mpfr_prec_t>(2 + i % 300));
+	}
+	// Decimal conversion, with a shared buffer.
+	std::string buffer;
+	for (const auto &r: values) {
+		buffer.clear();
+		r.to_decimal(buffer);
+		BOOST_CHECK_EQUAL(buffer,boost::lexical_cast<std::string>(r));
+		const auto tmp = real::from_decimal(buffer.data(),buffer.data() + buffer.size(),r.get_prec());
+		BOOST_CHECK(r.is_nan() ? tmp.is_nan() : tmp == r);
+	}
+	buffer = "1.5foo";
+	BOOST_CHECK_EQUAL(real::from_decimal(buffer.data(),buffer.data() + 3),real(1.5));
+	BOOST_CHECK_THROW(real::from_decimal(buffer.data(),buffer.data() + 4),std::invalid_argument);
+	// Binary conversion, all values in the same buffer.
+	buffer.clear();
+	for (const auto &r: values) {
+		r.to_binary(buffer);
+	}
+	const char *begin = buffer.data(), *end = buffer.data() + buffer.size();
+	for (const auto &r: values) {
+		const auto tmp = real::from_binary(begin,end);
+		BOOST_CHECK_EQUAL(tmp.get_prec(),r.get_prec());
+		BOOST_CHECK_EQUAL(tmp.sign(),r.sign());
+		BOOST_CHECK_EQUAL(tmp.is_nan(),r.is_nan());
+		BOOST_CHECK(r.is_nan() || tmp == r);
+		BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(tmp),boost::lexical_cast<std::string>(r));
+	}
+	BOOST_CHECK(begin == end);
+	BOOST_CHECK_THROW(real::from_binary(begin,end),std::invalid_argument);
+	// Truncated input.
+	buffer.clear();
+	real("1.1",200).to_binary(buffer);
+	begin = buffer.data();
+	end = buffer.data() + buffer.size() - 1u;
+	BOOST_CHECK_THROW(real::from_binary(begin,end),std::invalid_argument);
+}
@@ -30,7 +30,9 @@
 #include <cmath>
 #include <cstddef>
 #include <initializer_list>
+#include <random>
 #include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -570,6 +572,65 @@ BOOST_AUTO_TEST_CASE(rtkm_multiply_test)
 	boost::mpl::for_each<int_types>(multiply_tester());
 }
 
+// Random multiplications, checked against the component-wise computation. The ranges of the multipliers are
+// chosen so that both the codes-based path and the component-wise path of multiply() are exercised.
+struct multiply_random_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef real_trigonometric_kronecker_monomial<T> k_type;
+		typedef kronecker_array<T> ka;
+		const auto &limits = ka::get_limits();
+		std::mt19937 rng;
+		symbol_set vs;
+		for (std::size_t m = 1u; m < limits.size() && m < 8u; ++m) {
+			vs.add(std::string("x") + boost::lexical_cast<std::string>(m));
+			const auto &minmax_vec = std::get<0u>(limits[m]);
+			std::vector<T> v1(m), v2(m), plus(m), minus(m);
+			for (int n = 0; n < 1000; ++n) {
+				bool in_range = true;
+				for (std::size_t i = 0u; i < m; ++i) {
+					const long long M = (n % 2) ? minmax_vec[i] : minmax_vec[i] / 2;
+					std::uniform_int_distribution<long long> dist(-M,M);
+					v1[i] = static_cast<T>(dist(rng));
+					// Produce leading zeroes in the results.
+					v2[i] = (i < m / 2u && n % 3 == 0) ? v1[i] : static_cast<T>(dist(rng));
+					plus[i] = static_cast<T>(v1[i] + v2[i]);
+					minus[i] = static_cast<T>(v1[i] - v2[i]);
+					if (std::abs(static_cast<long long>(v1[i]) + v2[i]) > minmax_vec[i] ||
+						std::abs(static_cast<long long>(v1[i]) - v2[i]) > minmax_vec[i])
+					{
+						in_range = false;
+					}
+				}
+				k_type k1(v1.begin(),v1.end()), k2(v2.begin(),v2.end()), r_plus, r_minus;
+				k2.set_flavour(n % 5 != 0);
+				bool s_plus, s_minus;
+				if (!in_range) {
+					BOOST_CHECK_THROW(k1.multiply(r_plus,r_minus,k2,s_plus,s_minus,vs),std::invalid_argument);
+					continue;
+				}
+				k1.multiply(r_plus,r_minus,k2,s_plus,s_minus,vs);
+				k_type ref_plus(plus.begin(),plus.end()), ref_minus(minus.begin(),minus.end());
+				BOOST_CHECK_EQUAL(ref_plus.canonicalise(vs),s_plus);
+				BOOST_CHECK_EQUAL(ref_minus.canonicalise(vs),s_minus);
+				ref_plus.set_flavour(n % 5 != 0);
+				ref_minus.set_flavour(n % 5 != 0);
+				BOOST_CHECK(r_plus == ref_plus);
+				BOOST_CHECK(r_minus == ref_minus);
+				BOOST_CHECK(r_plus.is_compatible(vs));
+				BOOST_CHECK(r_minus.is_compatible(vs));
+			}
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(rtkm_multiply_random_test)
+{
+	boost::mpl::for_each<int_types>(multiply_random_tester());
+}
+
 struct equality_tester
 {
 	template <typename T>
@@ -1439,3 +1500,59 @@ BOOST_AUTO_TEST_CASE(rtkm_key_is_evaluable_test)
 {
 	boost::mpl::for_each<int_types>(is_evaluable_tester());
 }
+
+#if defined(PIRANHA_INT128_T)
+
+BOOST_AUTO_TEST_CASE(rtkm_int128_test)
+{
+	typedef PIRANHA_INT128_T int_type;
+	typedef real_trigonometric_kronecker_monomial<int_type> k_type;
+	symbol_set vs;
+	for (int i = 0; i < 12; ++i) {
+		vs.add(std::string("x") + static_cast<char>('a' + i));
+	}
+	// Multipliers beyond the 64-bit limits for 12 variables.
+	std::vector<int_type> v1, v2;
+	for (int i = 0; i < 12; ++i) {
+		v1.push_back(int_type(100 + i));
+		v2.push_back(int_type(i % 2 ? -(50 + i) : 50 + i));
+	}
+	k_type k1(v1.begin(),v1.end()), k2(v2.begin(),v2.end()), retval_plus, retval_minus;
+	k2.set_flavour(false);
+	bool sign_plus, sign_minus;
+	k1.multiply(retval_plus,retval_minus,k2,sign_plus,sign_minus,vs);
+	BOOST_CHECK(!sign_plus);
+	BOOST_CHECK(!sign_minus);
+	BOOST_CHECK(!retval_plus.get_flavour());
+	BOOST_CHECK(!retval_minus.get_flavour());
+	const auto u_plus = retval_plus.unpack(vs), u_minus = retval_minus.unpack(vs);
+	for (int i = 0; i < 12; ++i) {
+		BOOST_CHECK(u_plus[i] == v1[i] + v2[i]);
+		BOOST_CHECK(u_minus[i] == v1[i] - v2[i]);
+	}
+	BOOST_CHECK(k1.t_degree(vs) == int_type(12 * 100 + 66));
+	BOOST_CHECK(k1.t_order(vs) == int_type(12 * 100 + 66));
+	BOOST_CHECK_EQUAL(k1.hash(),static_cast<std::size_t>(k1.get_int()));
+	std::ostringstream oss;
+	k2.print(oss,vs);
+	BOOST_CHECK_EQUAL(oss.str().substr(0u,12u),"sin(50*xa-51");
+	// Canonicalisation and partial derivative.
+	k_type k3{int_type(-200),int_type(300)};
+	symbol_set vs2({symbol("x"),symbol("y")});
+	BOOST_CHECK(k3.canonicalise(vs2));
+	const auto ret = k3.partial(symbol("y"),vs2);
+	BOOST_CHECK_EQUAL(ret.first,integer(300));
+	BOOST_CHECK(!ret.second.get_flavour());
+	// Trigonometric substitution, checked against a narrower multiplier type.
+	real_trigonometric_kronecker_monomial<int> k4{-3,2};
+	k3 = k_type{int_type(-3),int_type(2)};
+	const auto ts = k3.t_subs("x",integer(5),integer(7),vs2);
+	const auto ts_ref = k4.t_subs("x",integer(5),integer(7),vs2);
+	BOOST_CHECK_EQUAL(ts.size(),2u);
+	BOOST_CHECK_EQUAL(ts[0u].first,ts_ref[0u].first);
+	BOOST_CHECK_EQUAL(ts[1u].first,ts_ref[1u].first);
+	BOOST_CHECK(ts[0u].second.unpack(vs2)[1u] == int_type(ts_ref[0u].second.unpack(vs2)[1u]));
+	BOOST_CHECK_EQUAL(ts[1u].second.get_flavour(),ts_ref[1u].second.get_flavour());
+}
+
+#endif
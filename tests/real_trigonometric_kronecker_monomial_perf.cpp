@@ -0,0 +1,144 @@
+/***************************************************************************
+ *   Copyright (C) 2009-2011 by Francesco Biscani                          *
+ *   bluescarni@gmail.com                                                  *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+
+#include "../src/real_trigonometric_kronecker_monomial.hpp"
+
+#define BOOST_TEST_MODULE real_trigonometric_kronecker_monomial_test
+#include <boost/test/unit_test.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/timer/timer.hpp>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <vector>
+
+#include "../src/environment.hpp"
+#include "../src/kronecker_array.hpp"
+#include "../src/symbol_set.hpp"
+
+using namespace piranha;
+
+// Number of monomials to process.
+static const std::size_t n_keys = 1000000ull;
+
+// Canonicalisation and multiplication of trigonometric monomials: unpack-based reference implementations
+// vs the methods of real_trigonometric_kronecker_monomial, which work on the codes.
+struct canonicalise_tester
+{
+	template <typename T>
+	void operator()(const T &)
+	{
+		typedef real_trigonometric_kronecker_monomial<T> k_type;
+		typedef kronecker_array<T> ka;
+		typedef typename k_type::v_type v_type;
+		const auto &l = ka::get_limits();
+		std::mt19937 rng;
+		for (std::size_t m: {std::size_t(3u),std::size_t(6u)}) {
+			std::cout << "Type: " << typeid(T).name() << ", dimension: " << m << '\n';
+			symbol_set args;
+			for (std::size_t i = 0u; i < m; ++i) {
+				args.add(std::string("x") + boost::lexical_cast<std::string>(i));
+			}
+			// Multipliers in a quarter of the allowed range, so that products never exceed the limits.
+			const auto &minmax_vec = std::get<0u>(l[m]);
+			std::vector<k_type> keys;
+			v_type tmp(static_cast<typename v_type::size_type>(m),T(0));
+			for (std::size_t j = 0u; j < n_keys; ++j) {
+				for (std::size_t i = 0u; i < m; ++i) {
+					std::uniform_int_distribution<long long> dist(-minmax_vec[i] / 4,minmax_vec[i] / 4);
+					tmp[static_cast<typename v_type::size_type>(i)] = static_cast<T>(dist(rng));
+				}
+				keys.push_back(k_type(tmp.begin(),tmp.end()));
+			}
+			// Reference canonicalisation of an unpacked vector.
+			auto ref_canonicalise = [](v_type &v) -> bool {
+				for (typename v_type::size_type i = 0u; i < v.size(); ++i) {
+					if (v[i] < T(0)) {
+						for (; i < v.size(); ++i) {
+							v[i] = static_cast<T>(-v[i]);
+						}
+						return true;
+					} else if (v[i] > T(0)) {
+						break;
+					}
+				}
+				return false;
+			};
+			long long acc = 0;
+			{
+				std::cout << "Canonicalisation, unpack and encode: ";
+				boost::timer::auto_cpu_timer t;
+				for (const auto &k: keys) {
+					auto v = k.unpack(args);
+					if (ref_canonicalise(v)) {
+						acc += ka::encode(v);
+					}
+				}
+			}
+			{
+				std::cout << "Canonicalisation, canonicalise(): ";
+				boost::timer::auto_cpu_timer t;
+				for (auto k: keys) {
+					if (k.canonicalise(args)) {
+						acc -= k.get_int();
+					}
+				}
+			}
+			k_type r_plus, r_minus;
+			bool s_plus, s_minus;
+			{
+				std::cout << "Multiplication, unpack and encode: ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t j = 1u; j < keys.size(); ++j) {
+					const auto v1 = keys[j - 1u].unpack(args), v2 = keys[j].unpack(args);
+					v_type plus, minus;
+					for (typename v_type::size_type i = 0u; i < v1.size(); ++i) {
+						plus.push_back(static_cast<T>(v1[i] + v2[i]));
+						minus.push_back(static_cast<T>(v1[i] - v2[i]));
+					}
+					s_plus = ref_canonicalise(plus);
+					s_minus = ref_canonicalise(minus);
+					acc += ka::encode(plus) + ka::encode(minus) + s_plus + s_minus;
+				}
+			}
+			{
+				std::cout << "Multiplication, multiply(): ";
+				boost::timer::auto_cpu_timer t;
+				for (std::size_t j = 1u; j < keys.size(); ++j) {
+					keys[j - 1u].multiply(r_plus,r_minus,keys[j],s_plus,s_minus,args);
+					acc -= r_plus.get_int() + r_minus.get_int() + s_plus + s_minus;
+				}
+			}
+			std::cout << "Checksum: " << acc << "\n\n";
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(real_trigonometric_kronecker_monomial_canonicalise_test)
+{
+	environment env;
+	boost::mpl::for_each<boost::mpl::vector<int,long long>>(canonicalise_tester());
+}
@@ -583,6 +583,36 @@ class debug_access<merge_args_tag>
 				BOOST_CHECK(merge_out.m_container.find(term_type(Cf(1),key_type{Expo(1),Expo(0)})) != merge_out.m_container.end());
 				BOOST_CHECK(merge_out.m_container.find(term_type(Cf(2),key_type{Expo(2),Expo(0)})) != merge_out.m_container.end());
 				compat_check(merge_out);
+				// Merging from an rvalue, and in place.
+				auto same_terms = [](const typename series_type::base &a, const typename series_type::base &b) -> bool {
+					if (a.size() != b.size()) {
+						return false;
+					}
+					for (auto it = a.m_container.begin(); it != a.m_container.end(); ++it) {
+						auto it_b = b.m_container.find(*it);
+						if (it_b == b.m_container.end() || it_b->m_cf != it->m_cf) {
+							return false;
+						}
+					}
+					return true;
+				};
+				auto s_copy(s);
+				auto merge_out2 = series_type::base::merge_args_impl(std::move(s_copy),ed2);
+				BOOST_CHECK(same_terms(merge_out2,merge_out));
+				compat_check(merge_out2);
+				// The moved-from series is cleared out.
+				BOOST_CHECK(s_copy.empty());
+				s_copy = s;
+				s_copy.in_place_merge_args(ed2);
+				BOOST_CHECK(same_terms(s_copy,merge_out));
+				BOOST_CHECK(s_copy.m_symbol_set == ed2);
+				compat_check(s_copy);
+				// Empty series.
+				s_copy = typename series_type::base{};
+				s_copy.m_symbol_set = ed1;
+				s_copy.in_place_merge_args(ed2);
+				BOOST_CHECK(s_copy.empty());
+				BOOST_CHECK(s_copy.m_symbol_set == ed2);
 			}
 		};
 		template <typename Cf>
@@ -26,7 +26,9 @@
 #include <boost/lexical_cast.hpp>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "../src/environment.hpp"
 #include "../src/type_traits.hpp"
@@ -69,6 +71,31 @@ BOOST_AUTO_TEST_CASE(symbol_constructor_test)
 	BOOST_CHECK_EQUAL(std::addressof(x5.get_name()),std::addressof(y.get_name()));
 }
 
+// Concurrent creation of symbols.
+BOOST_AUTO_TEST_CASE(symbol_thread_test)
+{
+	const unsigned n_threads = 4u, n_symbols = 100u;
+	std::vector<std::vector<std::string const *>> ptrs(n_threads);
+	std::vector<std::thread> threads;
+	for (unsigned i = 0u; i < n_threads; ++i) {
+		threads.emplace_back([i,&ptrs]() {
+			// Look up each name twice, to exercise both the global list and the thread-local cache.
+			for (unsigned j = 0u; j < 2u * n_symbols; ++j) {
+				ptrs[i].push_back(std::addressof(symbol("t" + boost::lexical_cast<std::string>(j % n_symbols)).get_name()));
+			}
+		});
+	}
+	for (auto &t: threads) {
+		t.join();
+	}
+	for (unsigned j = 0u; j < 2u * n_symbols; ++j) {
+		const auto ref = std::addressof(symbol("t" + boost::lexical_cast<std::string>(j % n_symbols)).get_name());
+		for (unsigned i = 0u; i < n_threads; ++i) {
+			BOOST_CHECK_EQUAL(ptrs[i][j],ref);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(symbol_operators_test)
 {
 	BOOST_CHECK_EQUAL(symbol("x"),symbol("x"));
@@ -23,8 +23,11 @@
 #define BOOST_TEST_MODULE symbol_set_test
 #include <boost/test/unit_test.hpp>
 
+#include <set>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "../src/environment.hpp"
 #include "../src/symbol.hpp"
@@ -154,3 +157,30 @@ BOOST_AUTO_TEST_CASE(symbol_set_diff_test)
 	BOOST_CHECK(ss3 == symbol_set({symbol("a"),symbol("c"),symbol("e")}));
 	BOOST_CHECK(ss2.diff(ss2) == symbol_set{});
 }
+
+BOOST_AUTO_TEST_CASE(symbol_set_positions_test)
+{
+	typedef symbol_set::positions positions;
+	typedef std::vector<symbol_set::size_type> v_type;
+	symbol_set ss;
+	positions p0(ss,std::set<std::string>{});
+	BOOST_CHECK(p0.begin() == p0.end());
+	BOOST_CHECK_EQUAL(p0.size(),0u);
+	positions p1(ss,{"a","b"});
+	BOOST_CHECK_EQUAL(p1.size(),0u);
+	ss.add("b");
+	ss.add("d");
+	ss.add("f");
+	positions p2(ss,std::set<std::string>{});
+	BOOST_CHECK_EQUAL(p2.size(),0u);
+	positions p3(ss,{"a","c","e","g"});
+	BOOST_CHECK_EQUAL(p3.size(),0u);
+	positions p4(ss,{"a","b","c","f"});
+	BOOST_CHECK(v_type(p4.begin(),p4.end()) == (v_type{0u,2u}));
+	BOOST_CHECK_EQUAL(p4.back(),2u);
+	positions p5(ss,{"b","d","f"});
+	BOOST_CHECK(v_type(p5.begin(),p5.end()) == (v_type{0u,1u,2u}));
+	positions p6(ss,{"A","d","z"});
+	BOOST_CHECK(v_type(p6.begin(),p6.end()) == (v_type{1u}));
+	BOOST_CHECK_EQUAL(p6.back(),1u);
+}
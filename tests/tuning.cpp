@@ -62,3 +62,19 @@ BOOST_AUTO_TEST_CASE(tuning_block_size_test)
 	BOOST_CHECK_THROW(tuning::set_multiplication_block_size(8000u),std::invalid_argument);
 	BOOST_CHECK_EQUAL(tuning::get_multiplication_block_size(),1024u);
 }
+
+BOOST_AUTO_TEST_CASE(tuning_crt_multiplication_test)
+{
+	BOOST_CHECK(!tuning::get_crt_multiplication());
+	tuning::set_crt_multiplication(true);
+	BOOST_CHECK(tuning::get_crt_multiplication());
+	std::thread t1([](){
+		while (tuning::get_crt_multiplication()) {}
+	});
+	std::thread t2([](){
+		tuning::set_crt_multiplication(false);
+	});
+	t1.join();
+	t2.join();
+	BOOST_CHECK(!tuning::get_crt_multiplication());
+}